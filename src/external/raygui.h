@@ -79,6 +79,9 @@
 *
 *       guiStyle size is by default: 16*(16 + 8) = 384 int = 384*4 bytes = 1536 bytes = 1.5 KB
 *
+*       A full style data array (properties already propagated) can be set at once with GuiSetStyleData(),
+*       a single copy, no per-property processing required (rGuiStyler can export styles that way)
+*
 *       Note that the first set of BASE properties (by default guiStyle[0..15]) belong to the generic style
 *       used for all controls, when any of those base values is set, it is automatically populated to all
 *       controls, so, specific control values overwriting generic style should be set after base values
@@ -144,6 +147,21 @@
 *       #define RAYGUI_DEBUG_TEXT_BOUNDS
 *           Draw text bounds rectangles for debug
 *
+*       #define RAYGUI_PROFILE_BEGIN(stage)
+*       #define RAYGUI_PROFILE_END(stage, bytes)
+*           Style loading stages profiling hooks, both must be defined, stages provided:
+*           HEADER_PARSE, PROPS_APPLY, ATLAS_INFLATE, GLYPHS_INFLATE, TEXTURE_CREATE
+*
+*       #define RAYGUI_NO_MMAP
+*           Avoid memory mapping binary style files on GuiLoadStyle() (POSIX platforms),
+*           file data is read into a heap buffer instead
+*
+*       #define RAYGUI_STYLE_CACHE
+*           Cache binary styles decoded by GuiLoadStyle()/GuiLoadStyleFromMemory() by content hash,
+*           reloading a cached style applies its properties and font directly (no decompression or
+*           texture upload), cache size can be defined with RAYGUI_STYLE_CACHE_SIZE (default: 8)
+*           WARNING: Cached fonts are owned by the cache, do not unload them, use GuiUnloadStyleCache()
+*
 *   VERSIONS HISTORY:
 *       5.0 (20-Jul-2026) ADDED: NEW control: GuiTabBar()
 *                         ADDED: Support up to 512 icons (v500)
@@ -153,6 +171,7 @@
 *                         ADDED: GuiDropdonwBox() properties: DROPDOWN_ARROW_HIDDEN, DROPDOWN_ROLL_UP
 *                         ADDED: GuiListView() property: LIST_ITEMS_BORDER_WIDTH
 *                         ADDED: GuiLoadIconsFromMemory(), used by GuiLoadIcons()
+*                         ADDED: GuiLoadStyleFromMemoryEx(), font data loaded CPU-side (no GPU required)
 *                         ADDED: Macros for inputs customization, raylib decoupling
 *                         ADDED: Control result return values: 1-RESULT_PRESSED, 2-RESULT_CHANGED, >2-Control_custom
 *                         REMOVED: GuiSpinner() from controls list, using BUTTON + VALUEBOX properties
@@ -165,6 +184,22 @@
 *                         REDESIGNED: WARNING: GuiMessageBox(), added parameter for btn return, unify result
 *                         REDESIGNED: WARNING: GuiTextInputBox(), added parameter for btn return, unify result
 *                         REVIEWED: GuiLoadIconsFromMemory(), fixed memory issues
+*                         REVIEWED: GuiLoadStyleFromMemory(), font data decompressed from file data, no copies
+*                         REVIEWED: GuiLoadStyle(), binary files memory mapped on POSIX platforms
+*                         ADDED: Style binary file version 700, sections directory for direct access
+*                         ADDED: GuiGetStyleSection(), GuiLoadStyleSectionData()
+*                         ADDED: Style font atlas reduced bit-depth data (8, 4, 1 bpp), expanded on loading
+*                         ADDED: Style sections LZ4 codec, self-contained decoder for fast style loading
+*                         ADDED: Style compact properties section (PRPC), delta coded ids and color back-references
+*                         ADDED: GuiLoadStyleProps(), properties records from any style version (PROP or PRPC)
+*                         ADDED: Style packed font glyphs sections (RC16, GL16), 16-bit recs and metrics
+*                         ADDED: Style content hash section (HASH), GuiGetStyleHash()
+*                         ADDED: Decoded styles cache by content hash (RAYGUI_STYLE_CACHE), GuiUnloadStyleCache()
+*                         ADDED: Styles bundle (.rgsb), GuiLoadStyleBundle(), GuiLoadStyleFromBundle(), shared fonts
+*                         REVIEWED: GuiLoadStyle(), text styles parsed in a single pass, file data read once
+*                         FIXED: GuiLoadStyle(), text style version line parsed as property
+*                         ADDED: Text styles named properties: CONTROL.PROPERTY = value (BUTTON.BORDER_WIDTH = 2)
+*                         ADDED: GuiSetStyleData(), set full style data array at once (single copy)
 *                         REVIEWED: Controls using text labels to use LABEL properties
 *                         REVIEWED: Replaced sprintf() by snprintf() for more safety
 *                         REVIEWED: GuiTabBar(), close tab with mouse middle button
@@ -542,6 +577,23 @@ typedef struct GuiStyleProp {
     int propertyValue;          // Property value
 } GuiStyleProp;
 
+// Style file section (.rgs v700)
+// NOTE: Used to access style file sections directly, section data points into file data (not decoded)
+typedef struct GuiStyleSection {
+    char id[4];                 // Section identifier (FOURCC): HASH, PROP, PRPC, FONT, ATLS, RECS, RC16, GLYP, GL16
+    int codec;                  // Section data codec (GuiStyleCodec)
+    int size;                   // Section data size (stored)
+    int dataSize;               // Section data size (decoded)
+    const unsigned char *data;  // Section data (stored), pointing into file data
+} GuiStyleSection;
+
+// Style file section codec
+typedef enum {
+    STYLE_CODEC_NONE = 0,       // Section data not compressed
+    STYLE_CODEC_DEFLATE,        // Section data compressed (DEFLATE), best compression ratio
+    STYLE_CODEC_LZ4             // Section data compressed (LZ4 block), fastest decompression
+} GuiStyleCodec;
+
 /*
 // Controls text style -NOT USED-
 // NOTE: Text style is defined by control
@@ -798,11 +850,23 @@ RAYGUIAPI Font GuiGetFont(void);                                // Get gui custo
 // Style set/get functions
 RAYGUIAPI void GuiSetStyle(int control, int property, int value); // Set one style property
 RAYGUIAPI int GuiGetStyle(int control, int property);           // Get one style property
+RAYGUIAPI void GuiSetStyleData(const unsigned int *styleData);  // Set all style properties at once, full style data array (already propagated)
 
 // Styles loading functions
 RAYGUIAPI void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
 RAYGUIAPI void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize); // Load style from memory (binary only)
+RAYGUIAPI void GuiLoadStyleFromMemoryEx(const unsigned char *fileData, int dataSize, Font *font, Image *fontImage, Rectangle *fontWhiteRec); // Load style from memory (binary only), font data CPU-side (no texture)
 RAYGUIAPI void GuiLoadStyleDefault(void);                       // Load style default over global style
+RAYGUIAPI GuiStyleSection GuiGetStyleSection(const unsigned char *fileData, int dataSize, const char *id); // Get style file section by id (v700), data not decoded
+RAYGUIAPI unsigned char *GuiLoadStyleSectionData(GuiStyleSection section, int *dataSize); // Load style file section data decoded, must be freed by user (RAYGUI_FREE)
+RAYGUIAPI unsigned char *GuiLoadStyleProps(const unsigned char *fileData, int dataSize, int *propertyCount); // Load style properties records (any version, PROP or PRPC), must be freed by user (RAYGUI_FREE)
+RAYGUIAPI unsigned long long GuiGetStyleHash(const unsigned char *fileData, int dataSize); // Get style content hash, stored in file (v700) or computed from file data
+RAYGUIAPI void GuiUnloadStyleCache(void);                       // Unload decoded styles cache (RAYGUI_STYLE_CACHE), font in use is kept
+RAYGUIAPI int GuiLoadStyleBundle(const char *fileName);         // Load styles bundle file (.rgsb), fonts loaded once, returns styles count
+RAYGUIAPI int GuiLoadStyleBundleFromMemory(const unsigned char *fileData, int dataSize); // Load styles bundle from memory, returns styles count
+RAYGUIAPI void GuiUnloadStyleBundle(void);                      // Unload styles bundle, font in use is kept
+RAYGUIAPI const char *GuiGetStyleBundleName(int index);         // Get style name from loaded styles bundle (NULL if not available)
+RAYGUIAPI void GuiLoadStyleFromBundle(int index);               // Load style from loaded styles bundle, default style loaded first
 
 // Tooltips management functions
 RAYGUIAPI void GuiEnableTooltip(void);                          // Enable gui tooltips (global state)
@@ -1171,6 +1235,21 @@ typedef enum {
     #define RAYGUI_FREE(p)          free(p)
 #endif
 
+// Memory mapped style files support (POSIX platforms) [GuiLoadStyle()]
+#if !defined(RAYGUI_NO_MMAP) && !defined(__EMSCRIPTEN__) && (defined(__linux__) || defined(__APPLE__) || defined(__unix__))
+    #define RAYGUI_SUPPORT_MMAP
+    #include <fcntl.h>              // Required for: open(), O_RDONLY
+    #include <unistd.h>             // Required for: close()
+    #include <sys/stat.h>           // Required for: fstat()
+    #include <sys/mman.h>           // Required for: mmap(), munmap()
+#endif
+
+// Allow custom profiling hooks for style loading stages
+#if !defined(RAYGUI_PROFILE_BEGIN) || !defined(RAYGUI_PROFILE_END)
+    #define RAYGUI_PROFILE_BEGIN(stage)
+    #define RAYGUI_PROFILE_END(stage, bytes)
+#endif
+
 #ifdef __cplusplus
     #define RAYGUI_CLITERAL(name) name
 #else
@@ -1485,12 +1564,62 @@ static unsigned int *guiIconsPtr = guiIcons;
 #define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
 #define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
 
+#if !defined(RAYGUI_MAX_LINE_BUFFER_SIZE)
+    #define RAYGUI_MAX_LINE_BUFFER_SIZE  256      // Maximum text line size, used on text measuring
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
 // Gui control property style color element
 typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 
+// Style font, loaded from style data with texture loaded
+typedef struct GuiStyleFont {
+    Font font;                      // Font data (glyphCount = 0 if no custom font)
+    Rectangle whiteRec;             // Font white rectangle, used on shapes drawing
+    unsigned int iconFontOffsetY;   // Font atlas icons offset (if icons baked)
+    char name[32];                  // Font filename
+} GuiStyleFont;
+
+// Style text line, tokenized from text style data (.rgs)
+// NOTE: Numeric fields parsed on tokenizing, string tokens point into text data (not NULL-terminated)
+typedef struct GuiStyleTextLine {
+    char type;                      // Line type: 'v' - version, 'p' - property, 'f' - font, other - ignored
+    int valueCount;                 // Line numeric values parsed
+    int values[3];                  // Line numeric values: v <version>, p <control_id> <property_id> <property_value>, f <font_size>
+    const char *tokens[2];          // Line string tokens: f <font_size> <token0> <token1>
+    int tokensLength[2];            // Line string tokens length
+} GuiStyleTextLine;
+
+// Style name, control or property name resolved to its id (text styles named properties)
+typedef struct GuiStyleName {
+    short id;                       // Control or property id
+    const char *name;               // Control or property name, same as enum value name
+} GuiStyleName;
+
+// Style bundle entry, style properties and font reference
+typedef struct GuiStyleBundleEntry {
+    char name[32];                  // Style name
+    unsigned char *propsData;       // Style properties records (8 bytes per property)
+    int propertyCount;              // Style properties count
+    int fontIndex;                  // Style font index in bundle fonts (-1 - no custom font)
+} GuiStyleBundleEntry;
+
+#if defined(RAYGUI_STYLE_CACHE)
+#if !defined(RAYGUI_STYLE_CACHE_SIZE)
+    #define RAYGUI_STYLE_CACHE_SIZE      8      // Maximum number of decoded styles cached
+#endif
+
+// Style cache entry, decoded style data by style content hash
+typedef struct GuiStyleCacheEntry {
+    unsigned long long hash;        // Style content hash (0 - empty entry)
+    unsigned char *propsData;       // Style properties records (8 bytes per property)
+    int propertyCount;              // Style properties count
+    GuiStyleFont font;              // Style font (glyphCount = 0 if no custom font)
+} GuiStyleCacheEntry;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -1530,6 +1659,73 @@ static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI
 
 static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
 
+static GuiStyleBundleEntry *guiStyleBundle = NULL; // Style bundle styles (.rgsb), loaded with GuiLoadStyleBundle()
+static int guiStyleBundleCount = 0;         // Style bundle styles count
+static GuiStyleFont *guiStyleBundleFonts = NULL; // Style bundle fonts, loaded once and shared by bundle styles
+static int guiStyleBundleFontCount = 0;     // Style bundle fonts count
+
+// Style properties names, used by text styles named properties: CONTROL.PROPERTY = value
+// NOTE: Names generated from GuiControl, GuiControlProperty and controls extended properties enums values,
+// so every name always maps to its enum id, lists sizes checked against enums and RAYGUI_MAX_* on compilation
+#define GUI_STYLE_NAME(id) { (short)(id), #id }
+#define GUI_STYLE_NAMES_CHECK(condition, check) typedef char guiStyleNamesCheck##check[(condition)? 1 : -1]
+
+static const GuiStyleName guiStyleControlNames[] = {
+    GUI_STYLE_NAME(DEFAULT), GUI_STYLE_NAME(LABEL), GUI_STYLE_NAME(BUTTON), GUI_STYLE_NAME(TOGGLE),
+    GUI_STYLE_NAME(SLIDER), GUI_STYLE_NAME(PROGRESSBAR), GUI_STYLE_NAME(CHECKBOX), GUI_STYLE_NAME(COMBOBOX),
+    GUI_STYLE_NAME(DROPDOWNBOX), GUI_STYLE_NAME(TEXTBOX), GUI_STYLE_NAME(VALUEBOX), GUI_STYLE_NAME(TABBAR),
+    GUI_STYLE_NAME(LISTVIEW), GUI_STYLE_NAME(COLORPICKER), GUI_STYLE_NAME(SCROLLBAR), GUI_STYLE_NAME(STATUSBAR)
+};
+static const GuiStyleName guiStylePropsNames[] = {
+    GUI_STYLE_NAME(BORDER_COLOR_NORMAL), GUI_STYLE_NAME(BASE_COLOR_NORMAL), GUI_STYLE_NAME(TEXT_COLOR_NORMAL),
+    GUI_STYLE_NAME(BORDER_COLOR_FOCUSED), GUI_STYLE_NAME(BASE_COLOR_FOCUSED), GUI_STYLE_NAME(TEXT_COLOR_FOCUSED),
+    GUI_STYLE_NAME(BORDER_COLOR_PRESSED), GUI_STYLE_NAME(BASE_COLOR_PRESSED), GUI_STYLE_NAME(TEXT_COLOR_PRESSED),
+    GUI_STYLE_NAME(BORDER_COLOR_DISABLED), GUI_STYLE_NAME(BASE_COLOR_DISABLED), GUI_STYLE_NAME(TEXT_COLOR_DISABLED),
+    GUI_STYLE_NAME(BORDER_WIDTH), GUI_STYLE_NAME(TEXT_PADDING), GUI_STYLE_NAME(TEXT_ALIGNMENT)
+};
+static const GuiStyleName guiStylePropsExtNames[RAYGUI_MAX_CONTROLS][RAYGUI_MAX_PROPS_EXTENDED] = {
+    { GUI_STYLE_NAME(TEXT_SIZE), GUI_STYLE_NAME(TEXT_SPACING), GUI_STYLE_NAME(LINE_COLOR), GUI_STYLE_NAME(BACKGROUND_COLOR),
+      GUI_STYLE_NAME(TEXT_LINE_SPACING), GUI_STYLE_NAME(TEXT_ALIGNMENT_VERTICAL), GUI_STYLE_NAME(TEXT_WRAP_MODE) },  // DEFAULT
+    { { 0 } },                                                              // LABEL
+    { { 0 } },                                                              // BUTTON
+    { GUI_STYLE_NAME(GROUP_PADDING), GUI_STYLE_NAME(GROUP_WIDTH_FULL) },    // TOGGLE
+    { GUI_STYLE_NAME(SLIDER_WIDTH), GUI_STYLE_NAME(SLIDER_PADDING) },       // SLIDER
+    { GUI_STYLE_NAME(PROGRESS_PADDING), GUI_STYLE_NAME(PROGRESS_SIDE) },    // PROGRESSBAR
+    { GUI_STYLE_NAME(CHECK_PADDING) },                                      // CHECKBOX
+    { GUI_STYLE_NAME(COMBO_BUTTON_WIDTH), GUI_STYLE_NAME(COMBO_BUTTON_SPACING) }, // COMBOBOX
+    { GUI_STYLE_NAME(ARROW_PADDING), GUI_STYLE_NAME(DROPDOWN_ITEMS_SPACING), GUI_STYLE_NAME(DROPDOWN_ARROW_HIDDEN), GUI_STYLE_NAME(DROPDOWN_ROLL_UP) }, // DROPDOWNBOX
+    { GUI_STYLE_NAME(TEXT_READONLY) },                                      // TEXTBOX
+    { GUI_STYLE_NAME(SPINNER_BUTTON_WIDTH), GUI_STYLE_NAME(SPINNER_BUTTON_SPACING) }, // VALUEBOX
+    { GUI_STYLE_NAME(TAB_ITEMS_WIDTH), GUI_STYLE_NAME(TAB_CLOSE_BUTTON), GUI_STYLE_NAME(TAB_LINE_SIDE) }, // TABBAR
+    { GUI_STYLE_NAME(LIST_ITEMS_HEIGHT), GUI_STYLE_NAME(LIST_ITEMS_SPACING), GUI_STYLE_NAME(SCROLLBAR_WIDTH), GUI_STYLE_NAME(SCROLLBAR_SIDE),
+      GUI_STYLE_NAME(LIST_ITEMS_BORDER_NORMAL), GUI_STYLE_NAME(LIST_ITEMS_BORDER_WIDTH) }, // LISTVIEW
+    { GUI_STYLE_NAME(COLOR_SELECTOR_SIZE), GUI_STYLE_NAME(HUEBAR_WIDTH), GUI_STYLE_NAME(HUEBAR_PADDING), GUI_STYLE_NAME(HUEBAR_SELECTOR_HEIGHT),
+      GUI_STYLE_NAME(HUEBAR_SELECTOR_OVERFLOW) },                           // COLORPICKER
+    { GUI_STYLE_NAME(ARROWS_SIZE), GUI_STYLE_NAME(ARROWS_VISIBLE), GUI_STYLE_NAME(SCROLL_SLIDER_PADDING), GUI_STYLE_NAME(SCROLL_SLIDER_SIZE),
+      GUI_STYLE_NAME(SCROLL_PADDING), GUI_STYLE_NAME(SCROLL_SPEED) },       // SCROLLBAR
+    { { 0 } },                                                              // STATUSBAR
+};
+
+GUI_STYLE_NAMES_CHECK(sizeof(guiStyleControlNames)/sizeof(GuiStyleName) == RAYGUI_MAX_CONTROLS, Controls);
+GUI_STYLE_NAMES_CHECK(sizeof(guiStylePropsNames)/sizeof(GuiStyleName) == (TEXT_ALIGNMENT + 1), Props);
+GUI_STYLE_NAMES_CHECK((STATUSBAR + 1) == RAYGUI_MAX_CONTROLS, ControlsEnum);
+GUI_STYLE_NAMES_CHECK((TEXT_ALIGNMENT + 1) <= RAYGUI_MAX_PROPS_BASE, PropsEnum);
+GUI_STYLE_NAMES_CHECK((TEXT_WRAP_MODE - RAYGUI_MAX_PROPS_BASE) < RAYGUI_MAX_PROPS_EXTENDED, PropsExtEnum);
+
+// Style names perfect hash table, built once from names lists on first use
+// NOTE: Every name key maps to a different slot (seed searched on build), names resolved
+// with a single slot check per lookup, no string compares required
+#define RAYGUI_STYLE_NAMES_TABLE_BITS   9       // Style names hash table size: 512 slots
+static unsigned int guiStyleNamesCheck[1 << RAYGUI_STYLE_NAMES_TABLE_BITS] = { 0 }; // Style names slots key check (0 - empty slot)
+static short guiStyleNamesId[1 << RAYGUI_STYLE_NAMES_TABLE_BITS] = { 0 };           // Style names slots id: control or property id
+static unsigned long long guiStyleNamesSeed = 0;    // Style names table seed, slots distribution
+static int guiStyleNamesState = 0;          // Style names table state: 0 - not built, 1 - ready, -1 - build failed
+
+#if defined(RAYGUI_STYLE_CACHE)
+static GuiStyleCacheEntry guiStyleCache[RAYGUI_STYLE_CACHE_SIZE] = { 0 };   // Decoded styles cache
+static int guiStyleCacheNext = 0;           // Next style cache entry to be replaced (round-robin)
+#endif
+
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
 //
@@ -1620,6 +1816,28 @@ static Vector3 ConvertRGBtoHSV(Vector3 rgb);                    // Convert color
 static void GuiTooltip(Rectangle controlRec);                   // Draw tooltip using control rec position
 static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue); // Scroll bar control, used by GuiScrollPanel()
 static int GuiFontIconBaking(Image *imFont, Font font, Rectangle *whiteRec); // Update font image atlas to append raygui icons
+static void GuiLoadStyleSections(const unsigned char *fileData, int dataSize, Font *font, Image *fontImage, Rectangle *fontWhiteRec); // Load style sections (v700), font sections decoded only if requested
+static unsigned char *GuiDecompressDataLZ4(const unsigned char *compData, int compDataSize, int dataSize); // Decompress LZ4 block data, original data size required
+static unsigned char *GuiLoadStylePropsCompact(const unsigned char *fileData, int dataSize, int *propsDataSize); // Load style compact properties section (v700) as properties records
+static bool GuiReadVarint(const unsigned char *data, int dataSize, int *offset, unsigned int *value); // Read variable length unsigned integer (LEB128), false if out of bounds
+static void GuiApplyStyleProps(const unsigned char *propsData, int propertyCount); // Apply style properties records, DEFAULT base properties propagated to all controls
+static unsigned long long GuiComputeDataHash(const unsigned char *data, int dataSize, unsigned long long seed); // Compute data hash (XXH64), seed to accumulate multiple data buffers
+static int GuiReadStyleTextLine(const char *text, int textSize, GuiStyleTextLine *line); // Read style text line tokens, returns line size (including line break)
+static bool GuiReadStyleTextNumber(const char *text, int textSize, int *pos, int *value); // Read style text number, decimal or hexadecimal (0x)
+static unsigned long long GuiGetStyleNameKey(unsigned long long nameHash, int tag); // Get style name key from name hash and tag (0 - control, 1 - property, 2 + controlId - extended property)
+static int GuiGetStyleNameId(unsigned long long key); // Get style name id from name key using perfect hash table (-1 if not found)
+static bool GuiBuildStyleNamesTable(void);  // Build style names perfect hash table
+static void GuiLoadStyleText(const char *text, int textSize, const char *fileName); // Load text style data, font and charset files relative to style file
+static bool GuiLoadStyleFont(const unsigned char *fileData, int dataSize, GuiStyleFont *styleFont); // Load style from memory with font texture loaded, font not set
+static void GuiSetStyleFont(const GuiStyleFont *styleFont);    // Set style font as gui font, including font name, white rectangle and icons offset
+static void GuiUnloadStyleFont(GuiStyleFont *styleFont);      // Unload style font, font in use is not unloaded
+static bool GuiIsStyleFontShared(Font font);                  // Check if font is owned by styles cache or style bundle
+#if defined(RAYGUI_STYLE_CACHE)
+static void GuiUnloadStyleCacheEntry(GuiStyleCacheEntry *entry); // Unload style cache entry, font in use is not unloaded
+#endif
+#if defined(RAYGUI_SUPPORT_MMAP)
+static bool GuiLoadStyleMapped(const char *fileName);           // Load binary style file memory mapped, parsed in place (no file data copy)
+#endif
 
 static Color GuiFade(Color color, float alpha); // Fade color by an alpha factor
 
@@ -1698,6 +1916,17 @@ int GuiGetStyle(int control, int property)
     return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
 }
 
+// Set all style properties at once
+// NOTE: Style data is expected to be a full style array, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) values,
+// with DEFAULT properties already propagated to all controls, no processing required, only one copy
+void GuiSetStyleData(const unsigned int *styleData)
+{
+    // NOTE: Default style lazy loading must be forced first, it also sets default font
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    if (styleData != NULL) memcpy(guiStyle, styleData, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(unsigned int));
+}
+
 //----------------------------------------------------------------------------------
 // Gui Controls Functions Definition
 //----------------------------------------------------------------------------------
@@ -4615,133 +4844,97 @@ void GuiSetTooltip(const char *tooltip) { guiTooltipPtr = tooltip; }
 // in that case, custom font image atlas is GRAY+ALPHA and pixel data can be compressed (DEFLATE)
 void GuiLoadStyle(const char *fileName)
 {
-    #define MAX_LINE_BUFFER_SIZE    256
-
-    bool tryBinary = false;
     if (!guiStyleLoaded) GuiLoadStyleDefault();
 
-    // Try reading the files as text file first
-    FILE *rgsFile = fopen(fileName, "rt");
+#if defined(RAYGUI_SUPPORT_MMAP)
+    // Try loading binary style file memory mapped first
+    // NOTE: Text style files are detected and loaded below (also in case mapping fails)
+    if (GuiLoadStyleMapped(fileName)) return;
+#endif
+
+    // Load file data once, text or binary style detected from first character
+    FILE *rgsFile = fopen(fileName, "rb");
 
     if (rgsFile != NULL)
     {
-        char buffer[MAX_LINE_BUFFER_SIZE] = { 0 };
-        fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+        fseek(rgsFile, 0, SEEK_END);
+        int fileDataSize = ftell(rgsFile);
+        fseek(rgsFile, 0, SEEK_SET);
 
-        if (buffer[0] == '#')
+        if (fileDataSize > 0)
         {
-            int controlId = 0;
-            int propertyId = 0;
-            unsigned int propertyValue = 0;
-            unsigned int version = 0;
-
-            while (!feof(rgsFile))
+            unsigned char *fileData = (unsigned char *)RAYGUI_CALLOC(fileDataSize, sizeof(unsigned char));
+            if (fileData != NULL)
             {
-                switch (buffer[0])
-                {
-                    case 'v':
-                    {
-                        sscanf(buffer, "v %d", &version);
-                    }
-                    case 'p':
-                    {
-                        // Style property: p <control_id> <property_id> <property_value> <property_name>
-
-                        sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue);
-                        GuiSetStyle(controlId, propertyId, (int)propertyValue);
-
-                    } break;
-                    case 'f':
-                    {
-                        // Style font: f <gen_font_size> <font_file> <charmap_file>
-
-                        int fontSize = 0;
-                        char charmapFileName[32] = { 0 };
-                        char fontFileName[32] = { 0 };
-
-                        if (version >= 600) sscanf(buffer, "f %d %31s %31[^\r\n]s", &fontSize, fontFileName, charmapFileName);
-                        else sscanf(buffer, "f %d %31s %31[^\r\n]s", &fontSize, charmapFileName, fontFileName);
-
-                        // GLOBAL: Copy font file name into guiFontName
-                        snprintf(guiFontName, 32, "%s", fontFileName);
-
-                        Font font = { 0 };
-                        int *codepoints = NULL;
-                        int codepointCount = 0;
-
-                        if (charmapFileName[0] != '0')
-                        {
-                            // Load text data from file
-                            // NOTE: Expected an UTF-8 array of codepoints, no separation
-                            char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
-                            codepoints = LoadCodepoints(textData, &codepointCount);
-                            UnloadFileText(textData);
-                        }
-
-                        if (fontFileName[0] != '\0')
-                        {
-                            // In case a font is already loaded and it is not default internal font, unload it
-                            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
-
-                            if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
-                            else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
-                        }
-
-                        // If font texture not properly loaded, revert to default font and size/spacing
-                        if (font.texture.id == 0)
-                        {
-                            font = GetFontDefault();
-                            GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
-                            GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
-                        }
-
-                        UnloadCodepoints(codepoints);
-
-                        if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
+                fileDataSize = (int)fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
 
-                    } break;
-                    default: break;
-                }
+                if (fileData[0] == '#') GuiLoadStyleText((const char *)fileData, fileDataSize, fileName);
+                else GuiLoadStyleFromMemory(fileData, fileDataSize);
 
-                fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+                RAYGUI_FREE(fileData);
             }
         }
-        else tryBinary = true;
 
         fclose(rgsFile);
     }
+}
+
+// Load style from memory
+// NOTE: Decoded styles are cached by content hash if RAYGUI_STYLE_CACHE is defined,
+// reloading a cached style does not require any data decompression or texture upload
+// WARNING: Binary files only
+void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+{
+#if defined(RAYGUI_STYLE_CACHE)
+    unsigned long long hash = GuiGetStyleHash(fileData, dataSize);
 
-    if (tryBinary)
+    for (int i = 0; (i < RAYGUI_STYLE_CACHE_SIZE) && (hash != 0); i++)
     {
-        rgsFile = fopen(fileName, "rb");
+        GuiStyleCacheEntry *entry = &guiStyleCache[i];
 
-        if (rgsFile != NULL)
+        if (entry->hash == hash)
         {
-            fseek(rgsFile, 0, SEEK_END);
-            int fileDataSize = ftell(rgsFile);
-            fseek(rgsFile, 0, SEEK_SET);
+            // Style already decoded: properties applied and font set, no font data decoding
+            RAYGUI_PROFILE_BEGIN(PROPS_APPLY);
+            GuiApplyStyleProps(entry->propsData, entry->propertyCount);
+            RAYGUI_PROFILE_END(PROPS_APPLY, entry->propertyCount*8);
 
-            if (fileDataSize > 0)
-            {
-                unsigned char *fileData = (unsigned char *)RAYGUI_CALLOC(fileDataSize, sizeof(unsigned char));
-                if (fileData != NULL)
-                {
-                    fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+            if (entry->font.font.glyphCount > 0) GuiSetStyleFont(&entry->font);
+
+            return;
+        }
+    }
+#endif
 
-                    GuiLoadStyleFromMemory(fileData, fileDataSize);
+    // Load style properties and font data, font texture loaded
+    GuiStyleFont styleFont = { 0 };
+    bool fontLoaded = GuiLoadStyleFont(fileData, dataSize, &styleFont);
 
-                    RAYGUI_FREE(fileData);
-                }
-            }
+    if (styleFont.font.texture.id > 0) GuiSetStyleFont(&styleFont);
+    else if (!fontLoaded) GuiSetFont(GetFontDefault());     // Fallback to default raylib font if font texture loading fails
 
-            fclose(rgsFile);
-        }
+#if defined(RAYGUI_STYLE_CACHE)
+    // Add decoded style to cache, replacing the oldest entry
+    // NOTE: Styles are not cached if font texture could not be loaded
+    if ((hash != 0) && fontLoaded)
+    {
+        GuiStyleCacheEntry *entry = &guiStyleCache[guiStyleCacheNext];
+        guiStyleCacheNext = (guiStyleCacheNext + 1)%RAYGUI_STYLE_CACHE_SIZE;
+
+        GuiUnloadStyleCacheEntry(entry);
+
+        entry->hash = hash;
+        entry->propsData = GuiLoadStyleProps(fileData, dataSize, &entry->propertyCount);
+        if (styleFont.font.texture.id > 0) entry->font = styleFont;
     }
+#endif
 }
 
-// Load style from memory
+// Load style from memory, font data is provided CPU-side (no texture loaded)
+// NOTE: Useful when no GPU context is available (i.e. command line tools), font data is not
+// loaded if font == NULL, font recs/glyphs and atlas image data must be freed by user (RAYGUI_FREE)
 // WARNING: Binary files only
-void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+void GuiLoadStyleFromMemoryEx(const unsigned char *fileData, int dataSize, Font *font, Image *fontImage, Rectangle *fontWhiteRec)
 {
     // Style File Structure (.rgs)
     // ------------------------------------------------------
@@ -4818,55 +5011,48 @@ void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
     // }
     // ------------------------------------------------------
 
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    // NOTE: File data is only read, compressed sections are decompressed directly from it (no copies)
+    const unsigned char *fileDataPtr = fileData;
 
     char signature[5] = { 0 };
     short version = 0;
     short reserved = 0;
     int propertyCount = 0;
 
+    RAYGUI_PROFILE_BEGIN(HEADER_PARSE);
     memcpy(signature, fileDataPtr, 4);
     memcpy(&version, fileDataPtr + 4, sizeof(short));
     memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
     memcpy(&propertyCount, fileDataPtr + 4 + 2 + 2, sizeof(int));
     fileDataPtr += 12;
+    RAYGUI_PROFILE_END(HEADER_PARSE, 12);
 
     if ((signature[0] == 'r') &&
         (signature[1] == 'G') &&
         (signature[2] == 'S') &&
         (signature[3] == ' '))
     {
-        short controlId = 0;
-        short propertyId = 0;
-        unsigned int propertyValue = 0;
-
-        for (int i = 0; i < propertyCount; i++)
+        // WARNING: Version 700 uses a sections directory, header properties count is the sections count
+        if (version >= 700)
         {
-            memcpy(&controlId, fileDataPtr, sizeof(short));
-            memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
-            memcpy(&propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
-            fileDataPtr += 8;
-
-            if (controlId == 0) // DEFAULT control
-            {
-                // If a DEFAULT property is loaded, it is propagated to all controls
-                // NOTE: All DEFAULT properties should be defined first in the file
-                GuiSetStyle(0, (int)propertyId, propertyValue);
-
-                if (propertyId < RAYGUI_MAX_PROPS_BASE) for (int j = 1; j < RAYGUI_MAX_CONTROLS; j++) GuiSetStyle(j, (int)propertyId, propertyValue);
-            }
-            else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
+            GuiLoadStyleSections(fileData, dataSize, font, fontImage, fontWhiteRec);
+            return;
         }
 
-        // Load custom font if available
-        // NOTE: Font texture loading requires raylib
+        RAYGUI_PROFILE_BEGIN(PROPS_APPLY);
+        GuiApplyStyleProps(fileDataPtr, propertyCount);
+        fileDataPtr += propertyCount*8;
+        RAYGUI_PROFILE_END(PROPS_APPLY, propertyCount*8);
+
+        // Load custom font data if available
+        // NOTE: Font texture is not loaded, font atlas image is returned
         int fontDataSize = 0;
         memcpy(&fontDataSize, fileDataPtr, sizeof(int));
         fileDataPtr += 4;
 
-        if (fontDataSize > 0)
+        if ((fontDataSize > 0) && (font != NULL))
         {
-            Font font = { 0 };
+            Font fontData = { 0 };
             int fontType = 0;   // 0-Normal, 1-SDF
 
             // WARNING: Version 600 adds 32 bytes for the font filename (with extension)
@@ -4878,14 +5064,14 @@ void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
             }
             else memset(guiFontName, 0, 32);
 
-            memcpy(&font.baseSize, fileDataPtr, sizeof(int));
-            memcpy(&font.glyphCount, fileDataPtr + 4, sizeof(int));
+            memcpy(&fontData.baseSize, fileDataPtr, sizeof(int));
+            memcpy(&fontData.glyphCount, fileDataPtr + 4, sizeof(int));
             memcpy(&fontType, fileDataPtr + 4 + 4, sizeof(int));
             fileDataPtr += 12;
 
             // Load font white rectangle
-            Rectangle fontWhiteRec = { 0 };
-            memcpy(&fontWhiteRec, fileDataPtr, sizeof(Rectangle));
+            Rectangle whiteRec = { 0 };
+            memcpy(&whiteRec, fileDataPtr, sizeof(Rectangle));
             fileDataPtr += 16;
 
             // Load font image parameters
@@ -4902,20 +5088,16 @@ void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
             memcpy(&imFont.format, fileDataPtr + 4 + 4, sizeof(int));
             fileDataPtr += 12;
 
+            RAYGUI_PROFILE_BEGIN(ATLAS_INFLATE);
             if ((fontImageCompSize > 0) && (fontImageCompSize != fontImageUncompSize))
             {
                 // Compressed font atlas image data (DEFLATE), it requires DecompressData()
                 int dataUncompSize = 0;
-                unsigned char *compData = (unsigned char *)RAYGUI_CALLOC(fontImageCompSize, sizeof(unsigned char));
-                memcpy(compData, fileDataPtr, fontImageCompSize);
+                imFont.data = DecompressData(fileDataPtr, fontImageCompSize, &dataUncompSize);
                 fileDataPtr += fontImageCompSize;
 
-                imFont.data = DecompressData(compData, fontImageCompSize, &dataUncompSize);
-
                 // Security check, dataUncompSize must match the provided fontImageUncompSize
                 if (dataUncompSize != fontImageUncompSize) RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted");
-
-                RAYGUI_FREE(compData);
             }
             else
             {
@@ -4924,11 +5106,14 @@ void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                 memcpy(imFont.data, fileDataPtr, fontImageUncompSize);
                 fileDataPtr += fontImageUncompSize;
             }
+            RAYGUI_PROFILE_END(ATLAS_INFLATE, fontImageUncompSize);
 
             // Load font recs data (glyphs position and size in the image atlas)
-            int recsDataSize = font.glyphCount*sizeof(Rectangle);
+            int recsDataSize = fontData.glyphCount*sizeof(Rectangle);
             int recsDataCompressedSize = 0;
 
+            RAYGUI_PROFILE_BEGIN(GLYPHS_INFLATE);
+
             // WARNING: Version 400 adds the compression size parameter
             if (version >= 400)
             {
@@ -4940,32 +5125,23 @@ void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
             if ((recsDataCompressedSize > 0) && (recsDataCompressedSize != recsDataSize))
             {
                 // Recs data is compressed, uncompress it
-                unsigned char *recsDataCompressed = (unsigned char *)RAYGUI_CALLOC(recsDataCompressedSize, sizeof(unsigned char));
-
-                memcpy(recsDataCompressed, fileDataPtr, recsDataCompressedSize);
-                fileDataPtr += recsDataCompressedSize;
-
                 int recsDataUncompSize = 0;
-                font.recs = (Rectangle *)DecompressData(recsDataCompressed, recsDataCompressedSize, &recsDataUncompSize);
+                fontData.recs = (Rectangle *)DecompressData(fileDataPtr, recsDataCompressedSize, &recsDataUncompSize);
+                fileDataPtr += recsDataCompressedSize;
 
                 // Security check, data uncompressed size must match the expected original data size
                 if (recsDataUncompSize != recsDataSize) RAYGUI_LOG("WARNING: Uncompressed font recs data could be corrupted");
-
-                RAYGUI_FREE(recsDataCompressed);
             }
             else
             {
                 // Recs data is uncompressed
-                font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
-                for (int i = 0; i < font.glyphCount; i++)
-                {
-                    memcpy(&font.recs[i], fileDataPtr, sizeof(Rectangle));
-                    fileDataPtr += sizeof(Rectangle);
-                }
+                fontData.recs = (Rectangle *)RAYGUI_CALLOC(fontData.glyphCount, sizeof(Rectangle));
+                memcpy(fontData.recs, fileDataPtr, recsDataSize);
+                fileDataPtr += recsDataSize;
             }
 
             // Load font glyphs info data
-            int glyphsDataSize = font.glyphCount*16;    // 16 bytes data per glyph
+            int glyphsDataSize = fontData.glyphCount*16;    // 16 bytes data per glyph
             int glyphsDataCompressedSize = 0;
 
             // WARNING: Version 400 adds the compression size parameter
@@ -4977,78 +5153,325 @@ void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
             }
 
             // Allocate required glyphs space to fill with data
-            font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+            fontData.glyphs = (GlyphInfo *)RAYGUI_CALLOC(fontData.glyphCount, sizeof(GlyphInfo));
 
             if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
             {
                 // Glyphs data is compressed, uncompress it
-                unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_CALLOC(glyphsDataCompressedSize, sizeof(unsigned char));
-
-                memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
-                fileDataPtr += glyphsDataCompressedSize;
-
                 int glyphsDataUncompSize = 0;
-                unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+                unsigned char *glyphsDataUncomp = DecompressData(fileDataPtr, glyphsDataCompressedSize, &glyphsDataUncompSize);
+                fileDataPtr += glyphsDataCompressedSize;
 
                 // Security check, data uncompressed size must match the expected original data size
                 if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
 
-                unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+                // NOTE: GlyphInfo first 16 bytes (value, offsetX, offsetY, advanceX) match file data layout
+                for (int i = 0; i < fontData.glyphCount; i++) memcpy(&fontData.glyphs[i], glyphsDataUncomp + i*16, 16);
 
-                for (int i = 0; i < font.glyphCount; i++)
-                {
-                    memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
-                    memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
-                    glyphsDataUncompPtr += 16;
-                }
-
-                RAYGUI_FREE(glypsDataCompressed);
                 RAYGUI_FREE(glyphsDataUncomp);
             }
             else
             {
                 // Glyphs data is uncompressed
-                for (int i = 0; i < font.glyphCount; i++)
+                for (int i = 0; i < fontData.glyphCount; i++) memcpy(&fontData.glyphs[i], fileDataPtr + i*16, 16);
+                fileDataPtr += glyphsDataSize;
+            }
+            RAYGUI_PROFILE_END(GLYPHS_INFLATE, recsDataSize + glyphsDataSize);
+
+            *font = fontData;
+            if (fontImage != NULL) *fontImage = imFont;
+            else RAYGUI_FREE(imFont.data);
+            if (fontWhiteRec != NULL) *fontWhiteRec = whiteRec;
+        }
+    }
+}
+
+// Get style file section by id (.rgs v700)
+// NOTE: Section data is not decoded, section.data points into fileData,
+// returned section is empty (data == NULL) if not found or file version < 700
+GuiStyleSection GuiGetStyleSection(const unsigned char *fileData, int dataSize, const char *id)
+{
+    GuiStyleSection section = { 0 };
+
+    if ((fileData == NULL) || (id == NULL) || (dataSize < 12)) return section;
+
+    short version = 0;
+    int sectionCount = 0;
+    memcpy(&version, fileData + 4, sizeof(short));
+    memcpy(&sectionCount, fileData + 4 + 2 + 2, sizeof(int));
+
+    // Security check, sections directory must fit into file data
+    if ((memcmp(fileData, "rGS ", 4) == 0) && (version >= 700) &&
+        (sectionCount > 0) && (sectionCount <= (dataSize - 12)/20))
+    {
+        for (int i = 0; i < sectionCount; i++)
+        {
+            const unsigned char *entry = fileData + 12 + i*20;
+
+            if (memcmp(entry, id, 4) == 0)
+            {
+                short codec = 0;
+                int offset = 0;
+                int size = 0;
+                memcpy(&codec, entry + 4, sizeof(short));
+                memcpy(&offset, entry + 4 + 4, sizeof(int));
+                memcpy(&size, entry + 4 + 4 + 4, sizeof(int));
+
+                // Security check, section data must be inside file data
+                if ((offset >= 12) && (size >= 0) && (offset <= dataSize) && (size <= (dataSize - offset)))
                 {
-                    memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
-                    memcpy(&font.glyphs[i].offsetY, fileDataPtr + 8, sizeof(int));
-                    memcpy(&font.glyphs[i].advanceX, fileDataPtr + 12, sizeof(int));
-                    fileDataPtr += 16;
+                    memcpy(section.id, entry, 4);
+                    section.codec = codec;
+                    section.size = size;
+                    memcpy(&section.dataSize, entry + 4 + 4 + 4 + 4, sizeof(int));
+                    section.data = fileData + offset;
                 }
+                else RAYGUI_LOG("WARNING: Style section [%.4s] out of file data bounds", id);
+
+                break;
             }
+        }
+    }
 
-#if defined(RAYGUI_FONT_ICONS_BAKING)
-            // Font atlas image icons baking
-            Rectangle updatedWhiteRec = { 0 };
-            guiIconFontOffsetY = GuiFontIconBaking(&imFont, font, &updatedWhiteRec);
-            if (guiIconFontOffsetY > 0) fontWhiteRec = updatedWhiteRec;
+    return section;
+}
+
+// Load style file section data decoded
+// NOTE: Returned data must be freed by user (RAYGUI_FREE)
+unsigned char *GuiLoadStyleSectionData(GuiStyleSection section, int *dataSize)
+{
+    unsigned char *data = NULL;
+    int size = 0;
+
+    if ((section.data != NULL) && (section.size > 0))
+    {
+        if (section.codec == STYLE_CODEC_DEFLATE) data = DecompressData(section.data, section.size, &size);
+        else if (section.codec == STYLE_CODEC_LZ4)
+        {
+            data = GuiDecompressDataLZ4(section.data, section.size, section.dataSize);
+            if (data != NULL) size = section.dataSize;
+        }
+        else if (section.codec == STYLE_CODEC_NONE)
+        {
+            data = (unsigned char *)RAYGUI_CALLOC(section.size, sizeof(unsigned char));
+            memcpy(data, section.data, section.size);
+            size = section.size;
+        }
+        else RAYGUI_LOG("WARNING: Style section [%.4s] codec not supported", section.id);
+
+        // Security check, decoded size must match the expected section data size
+        if ((data != NULL) && (size != section.dataSize)) RAYGUI_LOG("WARNING: Style section [%.4s] decoded data could be corrupted", section.id);
+    }
+
+    if (dataSize != NULL) *dataSize = size;
+
+    return data;
+}
+
+// Get style content hash
+// NOTE: Hash is read from file hash section (v700) if available, computed from file data otherwise
+unsigned long long GuiGetStyleHash(const unsigned char *fileData, int dataSize)
+{
+    unsigned long long hash = 0;
+    GuiStyleSection section = GuiGetStyleSection(fileData, dataSize, "HASH");
+
+    if ((section.data != NULL) && (section.codec == STYLE_CODEC_NONE) && (section.size == 8)) memcpy(&hash, section.data, 8);
+    else if ((fileData != NULL) && (dataSize > 0)) hash = GuiComputeDataHash(fileData, dataSize, 0);
+
+    return hash;
+}
+
+// Unload decoded styles cache
+// NOTE: Current gui font is not unloaded if cached, it is unloaded by GuiLoadStyleDefault()
+void GuiUnloadStyleCache(void)
+{
+#if defined(RAYGUI_STYLE_CACHE)
+    for (int i = 0; i < RAYGUI_STYLE_CACHE_SIZE; i++) GuiUnloadStyleCacheEntry(&guiStyleCache[i]);
+    guiStyleCacheNext = 0;
 #endif
+}
 
-#if !defined(RAYGUI_STANDALONE)
-            // Load texture from image
-            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
-            font.texture = LoadTextureFromImage(imFont);
+// Load styles bundle file (.rgsb)
+// NOTE: Bundle fonts are loaded once (texture uploaded), styles are loaded with GuiLoadStyleFromBundle()
+int GuiLoadStyleBundle(const char *fileName)
+{
+    int styleCount = 0;
+    FILE *rgsbFile = fopen(fileName, "rb");
+
+    if (rgsbFile != NULL)
+    {
+        fseek(rgsbFile, 0, SEEK_END);
+        int fileDataSize = ftell(rgsbFile);
+        fseek(rgsbFile, 0, SEEK_SET);
 
-            // Fallback to default raylib texture if font texture loading fails
-            if (font.texture.id != 0)
+        if (fileDataSize > 0)
+        {
+            unsigned char *fileData = (unsigned char *)RAYGUI_CALLOC(fileDataSize, sizeof(unsigned char));
+            if (fileData != NULL)
             {
-                // Set font texture source rectangle to be used as white texture to draw shapes
-                // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
-                if ((fontWhiteRec.x > 0) &&
-                    (fontWhiteRec.y > 0) &&
-                    (fontWhiteRec.width > 0) &&
-                    (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
+                if (fread(fileData, sizeof(unsigned char), fileDataSize, rgsbFile) == (size_t)fileDataSize) styleCount = GuiLoadStyleBundleFromMemory(fileData, fileDataSize);
+
+                RAYGUI_FREE(fileData);
             }
-            else font = GetFontDefault();
+        }
 
-            GuiSetFont(font);
-#endif
-            RAYGUI_FREE(imFont.data);
+        fclose(rgsbFile);
+    }
+
+    return styleCount;
+}
+
+// Load styles bundle from memory (.rgsb)
+// NOTE: Previous bundle is unloaded, styles properties are copied and fonts loaded (texture uploaded),
+// file data is not required after loading
+int GuiLoadStyleBundleFromMemory(const unsigned char *fileData, int dataSize)
+{
+    // Style Bundle File Structure (.rgsb)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGSB"
+    // 4       | 2       | short      | Version: 700
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | Num styles [styleCount]
+    // 12      | 4       | int        | Num fonts [fontCount] (shared by styles)
+
+    // Styles Directory (48 bytes per style)
+    // foreach (style)
+    // {
+    //   16+48*i | 32    | char       | Style name
+    //   ...     | 4     | int        | Style data offset (from file start)
+    //   ...     | 4     | int        | Style data size
+    //   ...     | 4     | int        | Style font index (-1 - no custom font)
+    //   ...     | 4     | int        | reserved
+    // }
+
+    // Fonts Directory (8 bytes per font)
+    // foreach (font)
+    // {
+    //   ...     | 4     | int        | Font data offset (from file start)
+    //   ...     | 4     | int        | Font data size
+    // }
+
+    // Styles data: style file (.rgs v700) with properties sections only
+    // Fonts data: style file (.rgs v700) with font sections only (FONT, ATLS, RECS, GLYP...)
+    // ------------------------------------------------------
+
+    GuiUnloadStyleBundle();
+
+    if ((fileData == NULL) || (dataSize < 16) || (memcmp(fileData, "rGSB", 4) != 0)) return 0;
+
+    short version = 0;
+    int styleCount = 0;
+    int fontCount = 0;
+    memcpy(&version, fileData + 4, sizeof(short));
+    memcpy(&styleCount, fileData + 8, sizeof(int));
+    memcpy(&fontCount, fileData + 12, sizeof(int));
+
+    // Security check, directories must fit into file data
+    if ((version < 700) || (styleCount <= 0) || (fontCount < 0) ||
+        (styleCount > (dataSize - 16)/48) || (fontCount > (dataSize - 16 - styleCount*48)/8))
+    {
+        RAYGUI_LOG("WARNING: Style bundle data could be corrupted");
+        return 0;
+    }
+
+    const unsigned char *fontsDirectory = fileData + 16 + styleCount*48;
+
+    // Load bundle fonts, textures uploaded once
+    // NOTE: Global font name is restored, it is only updated when a bundle style is loaded
+    char fontName[32] = { 0 };
+    memcpy(fontName, guiFontName, 32);
+
+    guiStyleBundleFonts = (GuiStyleFont *)RAYGUI_CALLOC((fontCount > 0)? fontCount : 1, sizeof(GuiStyleFont));
+    guiStyleBundleFontCount = fontCount;
+
+    for (int i = 0; i < fontCount; i++)
+    {
+        int offset = 0;
+        int size = 0;
+        memcpy(&offset, fontsDirectory + i*8, sizeof(int));
+        memcpy(&size, fontsDirectory + i*8 + 4, sizeof(int));
+
+        if ((offset >= 16) && (size > 0) && (offset <= dataSize) && (size <= (dataSize - offset)))
+        {
+            if (!GuiLoadStyleFont(fileData + offset, size, &guiStyleBundleFonts[i])) RAYGUI_LOG("WARNING: Style bundle font [%i] could not be loaded", i);
+        }
+        else RAYGUI_LOG("WARNING: Style bundle font [%i] out of file data bounds", i);
+    }
+
+    memcpy(guiFontName, fontName, 32);
+
+    // Load bundle styles properties
+    guiStyleBundle = (GuiStyleBundleEntry *)RAYGUI_CALLOC(styleCount, sizeof(GuiStyleBundleEntry));
+    guiStyleBundleCount = styleCount;
+
+    for (int i = 0; i < styleCount; i++)
+    {
+        const unsigned char *entry = fileData + 16 + i*48;
+        GuiStyleBundleEntry *style = &guiStyleBundle[i];
+        int offset = 0;
+        int size = 0;
+
+        memcpy(style->name, entry, 31);
+        memcpy(&offset, entry + 32, sizeof(int));
+        memcpy(&size, entry + 32 + 4, sizeof(int));
+        memcpy(&style->fontIndex, entry + 32 + 8, sizeof(int));
+
+        if ((style->fontIndex < 0) || (style->fontIndex >= fontCount)) style->fontIndex = -1;
+
+        if ((offset >= 16) && (size > 0) && (offset <= dataSize) && (size <= (dataSize - offset)))
+        {
+            style->propsData = GuiLoadStyleProps(fileData + offset, size, &style->propertyCount);
         }
+        else RAYGUI_LOG("WARNING: Style bundle style [%i] out of file data bounds", i);
     }
+
+    return styleCount;
+}
+
+// Unload styles bundle
+// NOTE: Current gui font is not unloaded if owned by the bundle, it is unloaded by GuiLoadStyleDefault()
+void GuiUnloadStyleBundle(void)
+{
+    for (int i = 0; i < guiStyleBundleCount; i++) RAYGUI_FREE(guiStyleBundle[i].propsData);
+    RAYGUI_FREE(guiStyleBundle);
+
+    // NOTE: Fonts count reset first, unloaded fonts are not shared anymore
+    int fontCount = guiStyleBundleFontCount;
+    guiStyleBundleFontCount = 0;
+    for (int i = 0; i < fontCount; i++) GuiUnloadStyleFont(&guiStyleBundleFonts[i]);
+    RAYGUI_FREE(guiStyleBundleFonts);
+
+    guiStyleBundle = NULL;
+    guiStyleBundleCount = 0;
+    guiStyleBundleFonts = NULL;
+}
+
+// Get style name from loaded styles bundle
+const char *GuiGetStyleBundleName(int index)
+{
+    if ((index < 0) || (index >= guiStyleBundleCount)) return NULL;
+
+    return guiStyleBundle[index].name;
+}
+
+// Load style from loaded styles bundle
+// NOTE: Default style is loaded first, style properties are applied and shared bundle font set,
+// no data decoding or texture upload required
+void GuiLoadStyleFromBundle(int index)
+{
+    if ((index < 0) || (index >= guiStyleBundleCount)) return;
+
+    GuiStyleBundleEntry *style = &guiStyleBundle[index];
+
+    GuiLoadStyleDefault();
+
+    RAYGUI_PROFILE_BEGIN(PROPS_APPLY);
+    GuiApplyStyleProps(style->propsData, style->propertyCount);
+    RAYGUI_PROFILE_END(PROPS_APPLY, style->propertyCount*8);
+
+    if ((style->fontIndex >= 0) && (guiStyleBundleFonts[style->fontIndex].font.texture.id > 0)) GuiSetStyleFont(&guiStyleBundleFonts[style->fontIndex]);
 }
 
 // Load style default over global style
@@ -5138,9 +5561,14 @@ void GuiLoadStyleDefault(void)
     if (guiFont.texture.id != GetFontDefault().texture.id)
     {
         // Unload previous font texture
-        UnloadTexture(guiFont.texture);
-        RAYGUI_FREE(guiFont.recs);
-        RAYGUI_FREE(guiFont.glyphs);
+        // NOTE: Fonts owned by styles cache or style bundle are not unloaded, they can be reused
+        if (!GuiIsStyleFontShared(guiFont))
+        {
+            UnloadTexture(guiFont.texture);
+            RAYGUI_FREE(guiFont.recs);
+            RAYGUI_FREE(guiFont.glyphs);
+        }
+
         guiFont.recs = NULL;
         guiFont.glyphs = NULL;
 
@@ -5353,13 +5781,13 @@ int GuiGetTextWidth(const char *text)
     int maxWidth = 0;
     const char *linePtr = text;
 
-    while ((linePtr[0] != '\0') && ((linePtr - text) < MAX_LINE_BUFFER_SIZE))
+    while ((linePtr[0] != '\0') && ((linePtr - text) < RAYGUI_MAX_LINE_BUFFER_SIZE))
     {
         int lineWidth = GetLineWidth(linePtr);
         if (lineWidth > maxWidth) maxWidth = lineWidth;
 
         // Skip to the next '\n' (or end of string/buffer)
-        while ((linePtr[0] != '\0') && (linePtr[0] != '\n') && ((linePtr - text) < MAX_LINE_BUFFER_SIZE))
+        while ((linePtr[0] != '\0') && (linePtr[0] != '\n') && ((linePtr - text) < RAYGUI_MAX_LINE_BUFFER_SIZE))
         {
             linePtr++;
         }
@@ -5406,7 +5834,7 @@ static int GetLineWidth(const char *text)
         {
             // Get size in bytes of the line, considering end of line and line break
             int size = 0;
-            for (int i = 0; i < MAX_LINE_BUFFER_SIZE; i++)
+            for (int i = 0; i < RAYGUI_MAX_LINE_BUFFER_SIZE; i++)
             {
                 if ((text[i] != '\0') && (text[i] != '\n')) size++;
                 else break;
@@ -6083,6 +6511,1052 @@ static int GuiFontIconBaking(Image *imFont, Font font, Rectangle *whiteRec)
     return iconOffsetY;
 }
 
+// Load style sections from memory (.rgs v700)
+// NOTE: Properties are applied first, font sections are only decoded if requested (font, fontImage)
+static void GuiLoadStyleSections(const unsigned char *fileData, int dataSize, Font *font, Image *fontImage, Rectangle *fontWhiteRec)
+{
+    // Style File Structure (.rgs v700)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGS "
+    // 4       | 2       | short      | Version: 700
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | Num sections [sectionCount]
+
+    // Sections Directory (20 bytes per section)
+    // foreach (section)
+    // {
+    //   12+20*i | 4     | char       | Section id (FOURCC)
+    //   ...     | 2     | short      | Section codec (0-NONE, 1-DEFLATE, 2-LZ4)
+    //   ...     | 2     | short      | reserved
+    //   ...     | 4     | int        | Section data offset (from file start)
+    //   ...     | 4     | int        | Section data size (stored)
+    //   ...     | 4     | int        | Section data size (decoded)
+    // }
+
+    // Sections Data (in any order, unknown sections are skipped)
+    // "HASH"  | 8       | Style content hash (XXH64) of all sections data following this section
+    // "PROP"  | 8*propCount | Properties: short ControlId, short PropertyId, int PropertyValue
+    //                         WARNING: Only properties that differ from default style, DEFAULT ones first
+    // "PRPC"  | ...     | Properties compact (replaces PROP), records sorted by control and property:
+    //                     byte header: value kind (bits 7-6), new control (bit 5), property delta (bits 4-0, 31-varint)
+    //                     [varint control delta] [varint property delta] value: 0-varint (zigzag),
+    //                     1-varint color back-reference, 2-int value (new color), 3-back-reference + byte alpha
+    // "FONT"  | 76      | Font parameters: char[32] font filename, int baseSize, int glyphCount,
+    //                     int type (0-NORMAL, 1-SDF), Rectangle whiteRec, int atlas width, height, format,
+    //                     int atlas data bits per pixel (16-GRAY+ALPHA, 8-ALPHA, 4/1-ALPHA indexed)
+    // "ATLS"  | imSize  | Font atlas image data, reduced bit-depth data expanded to GRAY+ALPHA on loading
+    //                     NOTE: 1 and 4 bpp: alpha palette (2 or 16 bytes) followed by packed indices (MSB first)
+    // "RECS"  | 16*glyphCount | Font glyphs rectangles (in atlas image)
+    // "RC16"  | 8*glyphCount  | Font glyphs rectangles packed (replaces RECS): unsigned short x, y, width, height
+    // "GLYP"  | 16*glyphCount | Font glyphs info: int value, offsetX, offsetY, advanceX
+    // "GL16"  | 10*glyphCount | Font glyphs info packed (replaces GLYP): int value[glyphCount],
+    //                           followed by short offsetX, offsetY, advanceX (per glyph)
+    // ------------------------------------------------------
+
+    // Load style properties, applied directly from file data if not compressed
+    GuiStyleSection section = GuiGetStyleSection(fileData, dataSize, "PROP");
+    const unsigned char *propsData = section.data;
+    unsigned char *propsDataDecoded = NULL;
+    int propsDataSize = section.size;
+
+    if ((section.data != NULL) && (section.codec != STYLE_CODEC_NONE))
+    {
+        propsDataDecoded = GuiLoadStyleSectionData(section, &propsDataSize);
+        propsData = propsDataDecoded;
+    }
+    else if (section.data == NULL)
+    {
+        // Compact properties section, decoded into properties records
+        propsDataDecoded = GuiLoadStylePropsCompact(fileData, dataSize, &propsDataSize);
+        propsData = propsDataDecoded;
+    }
+
+    int propertyCount = (propsData != NULL)? propsDataSize/8 : 0;
+
+    RAYGUI_PROFILE_BEGIN(PROPS_APPLY);
+    GuiApplyStyleProps(propsData, propertyCount);
+    RAYGUI_PROFILE_END(PROPS_APPLY, propertyCount*8);
+
+    RAYGUI_FREE(propsDataDecoded);
+
+    // Load custom font data if available and requested
+    // NOTE: Font texture is not loaded, font atlas image is only decoded if fontImage requested
+    if (font == NULL) return;
+
+    section = GuiGetStyleSection(fileData, dataSize, "FONT");
+    int fontParamsSize = 0;
+    unsigned char *fontParams = GuiLoadStyleSectionData(section, &fontParamsSize);
+
+    if ((fontParams != NULL) && (fontParamsSize >= 72))
+    {
+        Font fontData = { 0 };
+        Rectangle whiteRec = { 0 };
+        Image imFont = { 0 };
+        imFont.mipmaps = 1;
+        int atlasBpp = 16;      // Atlas data bits per pixel: 16-GRAY+ALPHA, 8-ALPHA, 4/1-ALPHA indexed
+
+        // GLOBAL: Copy font file name into guiFontName
+        memcpy(guiFontName, fontParams, 32);
+        memcpy(&fontData.baseSize, fontParams + 32, sizeof(int));
+        memcpy(&fontData.glyphCount, fontParams + 32 + 4, sizeof(int));
+        memcpy(&whiteRec, fontParams + 32 + 12, sizeof(Rectangle));
+        memcpy(&imFont.width, fontParams + 32 + 12 + 16, sizeof(int));
+        memcpy(&imFont.height, fontParams + 32 + 12 + 16 + 4, sizeof(int));
+        memcpy(&imFont.format, fontParams + 32 + 12 + 16 + 4 + 4, sizeof(int));
+        if (fontParamsSize >= 76) memcpy(&atlasBpp, fontParams + 32 + 12 + 16 + 4 + 4 + 4, sizeof(int));
+
+        // Load font atlas image data, only if requested
+        if (fontImage != NULL)
+        {
+            section = GuiGetStyleSection(fileData, dataSize, "ATLS");
+
+            RAYGUI_PROFILE_BEGIN(ATLAS_INFLATE);
+            int atlasDataSize = 0;
+            unsigned char *atlasData = GuiLoadStyleSectionData(section, &atlasDataSize);
+
+            // NOTE: Atlas image is always GRAY+ALPHA (PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: 2), pixels count
+            // is limited to fit decoded data size (2 bytes per pixel) into an int
+            long long pixelCount = (long long)imFont.width*imFont.height;
+            bool atlasValid = (imFont.width > 0) && (imFont.height > 0) && (imFont.format == 2) && (pixelCount <= (0x7fffffff/2));
+
+            if ((atlasData != NULL) && !atlasValid)
+            {
+                RAYGUI_LOG("WARNING: Font atlas image data could be corrupted");
+                RAYGUI_FREE(atlasData);
+            }
+            else if ((atlasData != NULL) && (atlasBpp < 16))
+            {
+                // Expand reduced bit-depth atlas data (alpha only) to GRAY+ALPHA, gray channel is white
+                int paletteSize = (atlasBpp < 8)? (1 << atlasBpp) : 0;
+
+                if (((atlasBpp == 8) || (atlasBpp == 4) || (atlasBpp == 1)) && (atlasDataSize >= (paletteSize + (pixelCount*atlasBpp + 7)/8)))
+                {
+                    unsigned char *pixels = (unsigned char *)RAYGUI_CALLOC(pixelCount*2, sizeof(unsigned char));
+
+                    for (int i = 0; i < pixelCount; i++)
+                    {
+                        int bit = i*atlasBpp;
+
+                        pixels[2*i] = 255;
+                        if (atlasBpp == 8) pixels[2*i + 1] = atlasData[i];
+                        else pixels[2*i + 1] = atlasData[(atlasData[paletteSize + bit/8] >> (8 - atlasBpp - bit%8)) & (paletteSize - 1)];
+                    }
+
+                    imFont.data = pixels;
+                }
+                else RAYGUI_LOG("WARNING: Font atlas image data could be corrupted");
+
+                RAYGUI_FREE(atlasData);
+            }
+            else if ((atlasData != NULL) && ((atlasBpp != 16) || (atlasDataSize < pixelCount*2)))
+            {
+                RAYGUI_LOG("WARNING: Font atlas image data could be corrupted");
+                RAYGUI_FREE(atlasData);
+            }
+            else imFont.data = atlasData;
+            RAYGUI_PROFILE_END(ATLAS_INFLATE, (imFont.data != NULL)? imFont.width*imFont.height*2 : 0);
+        }
+
+        RAYGUI_PROFILE_BEGIN(GLYPHS_INFLATE);
+
+        // Load font recs data (glyphs position and size in the image atlas)
+        int recsDataSize = 0;
+        section = GuiGetStyleSection(fileData, dataSize, "RECS");
+
+        if (section.data != NULL) fontData.recs = (Rectangle *)GuiLoadStyleSectionData(section, &recsDataSize);
+        else
+        {
+            // Packed recs section (16-bit), expanded to Rectangle in a single pass
+            section = GuiGetStyleSection(fileData, dataSize, "RC16");
+            unsigned char *recsData = GuiLoadStyleSectionData(section, &recsDataSize);
+
+            if ((recsData != NULL) && (fontData.glyphCount >= 0) && ((recsDataSize/8) >= fontData.glyphCount))
+            {
+                fontData.recs = (Rectangle *)RAYGUI_CALLOC(fontData.glyphCount, sizeof(Rectangle));
+
+                for (int i = 0; i < fontData.glyphCount; i++)
+                {
+                    unsigned short rec[4] = { 0 };
+                    memcpy(rec, recsData + i*8, 8);
+
+                    fontData.recs[i].x = (float)rec[0];
+                    fontData.recs[i].y = (float)rec[1];
+                    fontData.recs[i].width = (float)rec[2];
+                    fontData.recs[i].height = (float)rec[3];
+                }
+
+                recsDataSize = fontData.glyphCount*(int)sizeof(Rectangle);
+            }
+
+            RAYGUI_FREE(recsData);
+        }
+
+        if (recsDataSize < (int)(fontData.glyphCount*sizeof(Rectangle)))
+        {
+            RAYGUI_LOG("WARNING: Font recs data could be corrupted");
+            RAYGUI_FREE(fontData.recs);
+            fontData.recs = (Rectangle *)RAYGUI_CALLOC(fontData.glyphCount, sizeof(Rectangle));
+        }
+
+        // Load font glyphs info data, copied directly from file data if not compressed
+        section = GuiGetStyleSection(fileData, dataSize, "GLYP");
+        bool glyphsPacked = false;
+
+        if (section.data == NULL)
+        {
+            section = GuiGetStyleSection(fileData, dataSize, "GL16");
+            glyphsPacked = true;
+        }
+
+        const unsigned char *glyphsData = section.data;
+        unsigned char *glyphsDataDecoded = NULL;
+        int glyphsDataSize = section.size;
+
+        if ((section.data != NULL) && (section.codec != STYLE_CODEC_NONE))
+        {
+            glyphsDataDecoded = GuiLoadStyleSectionData(section, &glyphsDataSize);
+            glyphsData = glyphsDataDecoded;
+        }
+
+        // Allocate required glyphs space to fill with data
+        fontData.glyphs = (GlyphInfo *)RAYGUI_CALLOC(fontData.glyphCount, sizeof(GlyphInfo));
+
+        if ((glyphsData != NULL) && glyphsPacked && (fontData.glyphCount >= 0) && ((glyphsDataSize/10) >= fontData.glyphCount))
+        {
+            // Packed glyphs section: int values array followed by 16-bit metrics (offsetX, offsetY, advanceX)
+            const unsigned char *metricsData = glyphsData + fontData.glyphCount*4;
+
+            for (int i = 0; i < fontData.glyphCount; i++)
+            {
+                short metrics[3] = { 0 };
+                memcpy(&fontData.glyphs[i].value, glyphsData + i*4, 4);
+                memcpy(metrics, metricsData + i*6, 6);
+
+                fontData.glyphs[i].offsetX = metrics[0];
+                fontData.glyphs[i].offsetY = metrics[1];
+                fontData.glyphs[i].advanceX = metrics[2];
+            }
+        }
+        else if ((glyphsData != NULL) && !glyphsPacked && (glyphsDataSize >= fontData.glyphCount*16))
+        {
+            // NOTE: GlyphInfo first 16 bytes (value, offsetX, offsetY, advanceX) match file data layout
+            for (int i = 0; i < fontData.glyphCount; i++) memcpy(&fontData.glyphs[i], glyphsData + i*16, 16);
+        }
+        else RAYGUI_LOG("WARNING: Font glyphs data could be corrupted");
+
+        RAYGUI_FREE(glyphsDataDecoded);
+        RAYGUI_PROFILE_END(GLYPHS_INFLATE, fontData.glyphCount*(16 + 16));
+
+        *font = fontData;
+        if (fontImage != NULL) *fontImage = imFont;
+        if (fontWhiteRec != NULL) *fontWhiteRec = whiteRec;
+    }
+
+    RAYGUI_FREE(fontParams);
+}
+
+// Decompress LZ4 block data
+// NOTE: Self-contained decoder (no dependencies), original data size is required,
+// returns NULL if data is corrupted (any read or write out of bounds)
+static unsigned char *GuiDecompressDataLZ4(const unsigned char *compData, int compDataSize, int dataSize)
+{
+    if ((compData == NULL) || (compDataSize <= 0) || (dataSize < 0)) return NULL;
+
+    unsigned char *data = (unsigned char *)RAYGUI_CALLOC((dataSize > 0)? dataSize : 1, sizeof(unsigned char));
+    int inOffset = 0;
+    int outOffset = 0;
+    bool corrupted = false;
+
+    while (inOffset < compDataSize)
+    {
+        int token = compData[inOffset++];
+
+        // Copy literals
+        int literalsLength = token >> 4;
+        if (literalsLength == 15) while (inOffset < compDataSize) { int length = compData[inOffset++]; literalsLength += length; if (length != 255) break; }
+
+        if ((literalsLength > (compDataSize - inOffset)) || (literalsLength > (dataSize - outOffset))) { corrupted = true; break; }
+        memcpy(data + outOffset, compData + inOffset, literalsLength);
+        inOffset += literalsLength;
+        outOffset += literalsLength;
+
+        if (inOffset == compDataSize) break;    // Last sequence, only literals
+
+        // Copy match from already decompressed data
+        if ((inOffset + 2) > compDataSize) { corrupted = true; break; }
+        int offset = compData[inOffset] | (compData[inOffset + 1] << 8);
+        inOffset += 2;
+
+        int matchLength = (token & 0x0f) + 4;
+        if ((token & 0x0f) == 15) while (inOffset < compDataSize) { int length = compData[inOffset++]; matchLength += length; if (length != 255) break; }
+
+        if ((offset == 0) || (offset > outOffset) || (matchLength > (dataSize - outOffset))) { corrupted = true; break; }
+
+        // NOTE: Match can overlap with data being written (offset < matchLength), copied byte by byte
+        for (int i = 0; i < matchLength; i++, outOffset++) data[outOffset] = data[outOffset - offset];
+    }
+
+    if (corrupted || (outOffset != dataSize))
+    {
+        RAYGUI_LOG("WARNING: LZ4 data could be corrupted");
+        RAYGUI_FREE(data);
+        data = NULL;
+    }
+
+    return data;
+}
+
+// Load style compact properties section (.rgs v700) as properties records (8 bytes per property)
+// NOTE: Compact records are sorted by control and property: ids are delta coded, small values stored
+// as varints and colors as back-references to previous values, returns NULL if section not available
+static unsigned char *GuiLoadStylePropsCompact(const unsigned char *fileData, int dataSize, int *propsDataSize)
+{
+    GuiStyleSection section = GuiGetStyleSection(fileData, dataSize, "PRPC");
+    const unsigned char *compData = section.data;
+    unsigned char *compDataDecoded = NULL;
+    int compDataSize = section.size;
+
+    *propsDataSize = 0;
+
+    if (section.data == NULL) return NULL;
+
+    if (section.codec != STYLE_CODEC_NONE)
+    {
+        compDataDecoded = GuiLoadStyleSectionData(section, &compDataSize);
+        compData = compDataDecoded;
+        if (compData == NULL) return NULL;
+    }
+
+    // NOTE: Every compact record takes at least 2 bytes (header and value)
+    int maxCount = compDataSize/2 + 1;
+    unsigned char *propsData = (unsigned char *)RAYGUI_CALLOC(maxCount*8, sizeof(unsigned char));
+    unsigned int *values = (unsigned int *)RAYGUI_CALLOC(maxCount, sizeof(unsigned int));   // Values history, for back-references
+    int valuesCount = 0;
+
+    int propertyCount = 0;
+    int controlId = 0;
+    int propertyId = -1;
+    int offset = 0;
+    bool corrupted = false;
+
+    while ((offset < compDataSize) && !corrupted && (propertyCount < maxCount))
+    {
+        int header = compData[offset++];
+        int kind = header >> 6;
+        unsigned int delta = 0;
+
+        // Read control delta (new control) and property delta, property delta is relative to previous one
+        // NOTE: On new control, property delta is relative to -1 (property id)
+        if (header & 0x20)
+        {
+            if (!GuiReadVarint(compData, compDataSize, &offset, &delta)) { corrupted = true; break; }
+            controlId += (int)delta;
+            propertyId = -1;
+        }
+
+        delta = header & 0x1f;
+        if ((delta == 31) && !GuiReadVarint(compData, compDataSize, &offset, &delta)) { corrupted = true; break; }
+        propertyId += 1 + (int)delta;
+
+        // Read property value
+        unsigned int value = 0;
+        unsigned int reference = 0;     // Zigzag value or back-reference (distance from last value)
+
+        if ((kind != 2) && !GuiReadVarint(compData, compDataSize, &offset, &reference)) { corrupted = true; break; }
+
+        if (kind == 0) value = (reference >> 1) ^ (0u - (reference & 1));  // Zigzag decoding
+        else if (kind == 2)
+        {
+            if ((offset + 4) > compDataSize) { corrupted = true; break; }
+            memcpy(&value, compData + offset, sizeof(unsigned int));
+            offset += 4;
+            values[valuesCount++] = value;
+        }
+        else
+        {
+            if (reference >= (unsigned int)valuesCount) { corrupted = true; break; }
+            value = values[valuesCount - 1 - reference];
+
+            if (kind == 3)
+            {
+                if (offset >= compDataSize) { corrupted = true; break; }
+                value = (value & 0xffffff00) | compData[offset++];
+                values[valuesCount++] = value;
+            }
+        }
+
+        // Security check, ids must be valid style properties (GuiSetStyle() does not check bounds)
+        if ((controlId >= RAYGUI_MAX_CONTROLS) || (propertyId >= (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED))) { corrupted = true; break; }
+
+        unsigned short ids[2] = { (unsigned short)controlId, (unsigned short)propertyId };
+        memcpy(propsData + propertyCount*8, ids, 4);
+        memcpy(propsData + propertyCount*8 + 4, &value, sizeof(unsigned int));
+        propertyCount++;
+    }
+
+    if (corrupted || (offset < compDataSize)) RAYGUI_LOG("WARNING: Style compact properties data could be corrupted");
+
+    RAYGUI_FREE(values);
+    RAYGUI_FREE(compDataDecoded);
+
+    *propsDataSize = propertyCount*8;
+
+    return propsData;
+}
+
+// Read variable length unsigned integer (LEB128, 7 bits per byte)
+static bool GuiReadVarint(const unsigned char *data, int dataSize, int *offset, unsigned int *value)
+{
+    *value = 0;
+
+    for (int shift = 0; (shift <= 28) && (*offset < dataSize); shift += 7)
+    {
+        unsigned char byte = data[(*offset)++];
+        *value |= (unsigned int)(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0) return true;
+    }
+
+    return false;
+}
+
+// Apply style properties records (8 bytes per property)
+// NOTE: DEFAULT base properties are propagated to all controls,
+// all DEFAULT properties should be defined first
+// WARNING: Records with control or property id out of style bounds are skipped
+static void GuiApplyStyleProps(const unsigned char *propsData, int propertyCount)
+{
+    short controlId = 0;
+    short propertyId = 0;
+    unsigned int propertyValue = 0;
+    int skippedCount = 0;
+
+    for (int i = 0; i < propertyCount; i++)
+    {
+        memcpy(&controlId, propsData + i*8, sizeof(short));
+        memcpy(&propertyId, propsData + i*8 + 2, sizeof(short));
+        memcpy(&propertyValue, propsData + i*8 + 2 + 2, sizeof(unsigned int));
+
+        // Security check, GuiSetStyle() does not check bounds
+        if ((controlId < 0) || (controlId >= RAYGUI_MAX_CONTROLS) ||
+            (propertyId < 0) || (propertyId >= (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)))
+        {
+            skippedCount++;
+            continue;
+        }
+
+        if (controlId == 0) // DEFAULT control
+        {
+            // If a DEFAULT property is loaded, it is propagated to all controls
+            GuiSetStyle(0, (int)propertyId, propertyValue);
+
+            if (propertyId < RAYGUI_MAX_PROPS_BASE) for (int j = 1; j < RAYGUI_MAX_CONTROLS; j++) GuiSetStyle(j, (int)propertyId, propertyValue);
+        }
+        else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
+    }
+
+    if (skippedCount > 0) RAYGUI_LOG("WARNING: Style properties not valid, %i properties skipped", skippedCount);
+}
+
+// Read style text line tokens
+// NOTE: Single pass over line characters, decimal and hexadecimal (0x) values parsed in place,
+// no line length limit and no NULL-terminated text required
+// NOTE: Named property lines (CONTROL.PROPERTY = value) are resolved to property lines ('p'),
+// names are hashed while read and resolved with the style names perfect hash table
+static int GuiReadStyleTextLine(const char *text, int textSize, GuiStyleTextLine *line)
+{
+    int pos = 0;
+
+    memset(line, 0, sizeof(GuiStyleTextLine));
+    if (textSize <= 0) return 0;
+
+    line->type = text[0];
+
+    if ((line->type >= 'A') && (line->type <= 'Z'))
+    {
+        // Named property: CONTROL.PROPERTY = value
+        unsigned long long nameHash[2] = { 0 };
+
+        for (int n = 0; n < 2; n++)
+        {
+            nameHash[n] = 0xcbf29ce484222325ULL;      // FNV-1a 64bit offset basis
+
+            while ((pos < textSize) && (((text[pos] >= 'A') && (text[pos] <= 'Z')) || ((text[pos] >= '0') && (text[pos] <= '9')) || (text[pos] == '_')))
+            {
+                nameHash[n] = (nameHash[n] ^ (unsigned char)text[pos])*0x100000001b3ULL;
+                pos++;
+            }
+
+            if ((n == 0) && ((pos >= textSize) || (text[pos] != '.'))) break;
+            if (n == 0) pos++;
+            else
+            {
+                while ((pos < textSize) && ((text[pos] == ' ') || (text[pos] == '\t'))) pos++;
+
+                if ((pos < textSize) && (text[pos] == '='))
+                {
+                    pos++;
+                    if (GuiReadStyleTextNumber(text, textSize, &pos, &line->values[2])) line->valueCount = 1;
+                }
+            }
+        }
+
+        if (line->valueCount == 1)
+        {
+            int controlId = GuiGetStyleNameId(GuiGetStyleNameKey(nameHash[0], 0));
+            int propertyId = -1;
+
+            if (controlId >= 0)
+            {
+                propertyId = GuiGetStyleNameId(GuiGetStyleNameKey(nameHash[1], 2 + controlId));
+                if (propertyId < 0) propertyId = GuiGetStyleNameId(GuiGetStyleNameKey(nameHash[1], 1));
+            }
+
+            if (propertyId >= 0)
+            {
+                line->type = 'p';
+                line->values[0] = controlId;
+                line->values[1] = propertyId;
+                line->valueCount = 3;
+            }
+            else
+            {
+                RAYGUI_LOG("WARNING: Style property name not found: %.*s", pos, text);
+                line->valueCount = 0;
+            }
+        }
+    }
+    else
+    {
+        pos++;
+
+        int fieldCount = 0;
+        if (line->type == 'p') fieldCount = 3;
+        else if ((line->type == 'v') || (line->type == 'f')) fieldCount = 1;
+
+        for (int i = 0; i < fieldCount; i++)
+        {
+            if (!GuiReadStyleTextNumber(text, textSize, &pos, &line->values[i])) break;
+            line->valueCount++;
+        }
+
+        if ((line->type == 'f') && (line->valueCount == 1))
+        {
+            // Font line tokens: first token until blank, second token until line end
+            for (int t = 0; t < 2; t++)
+            {
+                while ((pos < textSize) && ((text[pos] == ' ') || (text[pos] == '\t'))) pos++;
+
+                int start = pos;
+                while ((pos < textSize) && (text[pos] != '\n') && (text[pos] != '\r') &&
+                       ((t == 1) || ((text[pos] != ' ') && (text[pos] != '\t')))) pos++;
+
+                line->tokens[t] = text + start;
+                line->tokensLength[t] = pos - start;
+            }
+        }
+    }
+
+    // Skip remaining line characters (property name, comments...)
+    while ((pos < textSize) && (text[pos] != '\n')) pos++;
+    if (pos < textSize) pos++;
+
+    return pos;
+}
+
+// Read style text number, decimal or hexadecimal (0x)
+// NOTE: Leading blanks skipped, position updated, returns false if no digits available
+static bool GuiReadStyleTextNumber(const char *text, int textSize, int *pos, int *value)
+{
+    int i = *pos;
+    bool hex = false;
+    bool negative = false;
+    unsigned int result = 0;
+    int digits = 0;
+
+    while ((i < textSize) && ((text[i] == ' ') || (text[i] == '\t'))) i++;
+
+    if (((i + 1) < textSize) && (text[i] == '0') && ((text[i + 1] == 'x') || (text[i + 1] == 'X')))
+    {
+        hex = true;
+        i += 2;
+    }
+    else if ((i < textSize) && ((text[i] == '-') || (text[i] == '+')))
+    {
+        negative = (text[i] == '-');
+        i++;
+    }
+
+    while (i < textSize)
+    {
+        char c = text[i];
+        unsigned int digit = 0;
+
+        if ((c >= '0') && (c <= '9')) digit = c - '0';
+        else if (hex && (c >= 'a') && (c <= 'f')) digit = c - 'a' + 10;
+        else if (hex && (c >= 'A') && (c <= 'F')) digit = c - 'A' + 10;
+        else break;
+
+        result = result*(hex? 16 : 10) + digit;
+        digits++;
+        i++;
+    }
+
+    *pos = i;
+    if (digits > 0) *value = (int)(negative? (0u - result) : result);
+
+    return (digits > 0);
+}
+
+// Get style name key from name hash and tag
+// NOTE: Tag differentiates names by kind: 0 - control, 1 - base property, 2 + controlId - control extended property
+static unsigned long long GuiGetStyleNameKey(unsigned long long nameHash, int tag)
+{
+    unsigned long long key = (nameHash ^ ((unsigned long long)(tag + 1)*0x9e3779b97f4a7c15ULL))*0xff51afd7ed558ccdULL;
+
+    return key ^ (key >> 29);
+}
+
+// Get style name id from name key using perfect hash table
+// NOTE: Table is built on first use, key checked against the only slot it can be placed (no probing)
+static int GuiGetStyleNameId(unsigned long long key)
+{
+    if (guiStyleNamesState == 0) guiStyleNamesState = GuiBuildStyleNamesTable()? 1 : -1;
+    if (guiStyleNamesState < 0) return -1;
+
+    unsigned int slot = (unsigned int)(((key ^ guiStyleNamesSeed)*0xc4ceb9fe1a85ec53ULL) >> (64 - RAYGUI_STYLE_NAMES_TABLE_BITS));
+    unsigned int check = (unsigned int)key | 1;     // NOTE: Check value 0 reserved for empty slots
+
+    return (guiStyleNamesCheck[slot] == check)? guiStyleNamesId[slot] : -1;
+}
+
+// Build style names perfect hash table
+// NOTE: Seeds are tested until all names keys are placed on different slots, table is only built once
+static bool GuiBuildStyleNamesTable(void)
+{
+    #define MAX_STYLE_NAMES     (RAYGUI_MAX_CONTROLS + RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_CONTROLS*RAYGUI_MAX_PROPS_EXTENDED)
+
+    const char *names[MAX_STYLE_NAMES] = { 0 };
+    int tags[MAX_STYLE_NAMES] = { 0 };
+    short ids[MAX_STYLE_NAMES] = { 0 };
+    unsigned long long keys[MAX_STYLE_NAMES] = { 0 };
+    int keyCount = 0;
+
+    // Controls names (tag 0) and base properties names (tag 1)
+    for (int i = 0; i < (int)(sizeof(guiStyleControlNames)/sizeof(GuiStyleName)); i++)
+    {
+        names[keyCount] = guiStyleControlNames[i].name;
+        tags[keyCount] = 0;
+        ids[keyCount++] = guiStyleControlNames[i].id;
+    }
+
+    for (int i = 0; i < (int)(sizeof(guiStylePropsNames)/sizeof(GuiStyleName)); i++)
+    {
+        names[keyCount] = guiStylePropsNames[i].name;
+        tags[keyCount] = 1;
+        ids[keyCount++] = guiStylePropsNames[i].id;
+    }
+
+    // Controls extended properties names (tag 2 + controlId)
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < RAYGUI_MAX_PROPS_EXTENDED; j++)
+        {
+            names[keyCount] = guiStylePropsExtNames[i][j].name;
+            tags[keyCount] = 2 + i;
+            ids[keyCount++] = guiStylePropsExtNames[i][j].id;
+        }
+    }
+
+    // Compute names keys, unused names removed
+    int count = 0;
+    for (int k = 0; k < keyCount; k++)
+    {
+        if (names[k] == NULL) continue;
+
+        unsigned long long nameHash = 0xcbf29ce484222325ULL;      // FNV-1a 64bit, same as GuiReadStyleTextLine()
+        for (int i = 0; names[k][i] != '\0'; i++) nameHash = (nameHash ^ (unsigned char)names[k][i])*0x100000001b3ULL;
+
+        keys[count] = GuiGetStyleNameKey(nameHash, tags[k]);
+        ids[count] = ids[k];
+        count++;
+    }
+    keyCount = count;
+
+    for (unsigned long long seed = 1; seed < 100000; seed++)
+    {
+        bool collision = false;
+        memset(guiStyleNamesCheck, 0, sizeof(guiStyleNamesCheck));
+
+        for (int k = 0; (k < keyCount) && !collision; k++)
+        {
+            unsigned int slot = (unsigned int)(((keys[k] ^ seed)*0xc4ceb9fe1a85ec53ULL) >> (64 - RAYGUI_STYLE_NAMES_TABLE_BITS));
+
+            if (guiStyleNamesCheck[slot] != 0) collision = true;
+            else
+            {
+                guiStyleNamesCheck[slot] = (unsigned int)keys[k] | 1;
+                guiStyleNamesId[slot] = ids[k];
+            }
+        }
+
+        if (!collision)
+        {
+            guiStyleNamesSeed = seed;
+            return true;
+        }
+    }
+
+    memset(guiStyleNamesCheck, 0, sizeof(guiStyleNamesCheck));
+    RAYGUI_LOG("WARNING: Style names table could not be built, named properties not supported");
+
+    return false;
+}
+
+// Load text style data (.rgs)
+// NOTE: Style text parsed in a single pass, font and charset files loaded relative to style file
+static void GuiLoadStyleText(const char *text, int textSize, const char *fileName)
+{
+    GuiStyleTextLine line = { 0 };
+    int version = 0;
+
+    for (int pos = 0, lineSize = 0; pos < textSize; pos += lineSize)
+    {
+        lineSize = GuiReadStyleTextLine(text + pos, textSize - pos, &line);
+
+        switch (line.type)
+        {
+            case 'v': if (line.valueCount == 1) version = line.values[0]; break;
+            case 'p':
+            {
+                // Style property: p <control_id> <property_id> <property_value> <property_name>
+                // NOTE: Named properties (CONTROL.PROPERTY = value) are also returned as property lines
+                if (line.valueCount == 3) GuiSetStyle(line.values[0], line.values[1], line.values[2]);
+
+            } break;
+            case 'f':
+            {
+                // Style font: f <gen_font_size> <font_file> <charmap_file>
+                // NOTE: Font and charmap files order changed on version 600
+                if (line.valueCount < 1) break;
+
+                int fontSize = line.values[0];
+                char charmapFileName[32] = { 0 };
+                char fontFileName[32] = { 0 };
+                int fontToken = (version >= 600)? 0 : 1;
+
+                snprintf(fontFileName, 32, "%.*s", line.tokensLength[fontToken], line.tokens[fontToken]);
+                snprintf(charmapFileName, 32, "%.*s", line.tokensLength[1 - fontToken], line.tokens[1 - fontToken]);
+
+                // GLOBAL: Copy font file name into guiFontName
+                snprintf(guiFontName, 32, "%s", fontFileName);
+
+                Font font = { 0 };
+                int *codepoints = NULL;
+                int codepointCount = 0;
+
+                if ((charmapFileName[0] != '\0') && (charmapFileName[0] != '0'))
+                {
+                    // Load text data from file
+                    // NOTE: Expected an UTF-8 array of codepoints, no separation
+                    char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
+                    if (textData != NULL) codepoints = LoadCodepoints(textData, &codepointCount);
+                    UnloadFileText(textData);
+                }
+
+                if (fontFileName[0] != '\0')
+                {
+                    if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
+                    else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
+                }
+
+                // If font texture not properly loaded, revert to default font and size/spacing
+                if (font.texture.id == 0)
+                {
+                    font = GetFontDefault();
+                    GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
+                    GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
+                }
+
+                UnloadCodepoints(codepoints);
+
+                if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
+
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Compute data hash (XXH64)
+// NOTE: Data processed in 32 bytes stripes (4 lanes), several times faster than byte-wise hashes,
+// previous hash can be provided as seed to accumulate multiple data buffers, 0 to start a new hash
+static unsigned long long GuiComputeDataHash(const unsigned char *data, int dataSize, unsigned long long seed)
+{
+    #define GUI_XXH_PRIME64_1   0x9e3779b185ebca87ULL
+    #define GUI_XXH_PRIME64_2   0xc2b2ae3d27d4eb4fULL
+    #define GUI_XXH_PRIME64_3   0x165667b19e3779f9ULL
+    #define GUI_XXH_PRIME64_4   0x85ebca77c2b2ae63ULL
+    #define GUI_XXH_PRIME64_5   0x27d4eb2f165667c5ULL
+    #define GUI_XXH_ROTL64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+    const unsigned char *ptr = data;
+    const unsigned char *end = data + dataSize;
+    unsigned long long hash = 0;
+    unsigned long long lane = 0;
+
+    if (dataSize >= 32)
+    {
+        unsigned long long acc[4] = { seed + GUI_XXH_PRIME64_1 + GUI_XXH_PRIME64_2, seed + GUI_XXH_PRIME64_2, seed, seed - GUI_XXH_PRIME64_1 };
+
+        while ((end - ptr) >= 32)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                memcpy(&lane, ptr + i*8, 8);
+                acc[i] += lane*GUI_XXH_PRIME64_2;
+                acc[i] = GUI_XXH_ROTL64(acc[i], 31)*GUI_XXH_PRIME64_1;
+            }
+
+            ptr += 32;
+        }
+
+        hash = GUI_XXH_ROTL64(acc[0], 1) + GUI_XXH_ROTL64(acc[1], 7) + GUI_XXH_ROTL64(acc[2], 12) + GUI_XXH_ROTL64(acc[3], 18);
+
+        for (int i = 0; i < 4; i++)
+        {
+            acc[i] *= GUI_XXH_PRIME64_2;
+            hash ^= GUI_XXH_ROTL64(acc[i], 31)*GUI_XXH_PRIME64_1;
+            hash = hash*GUI_XXH_PRIME64_1 + GUI_XXH_PRIME64_4;
+        }
+    }
+    else hash = seed + GUI_XXH_PRIME64_5;
+
+    hash += (unsigned long long)dataSize;
+
+    // Remaining data: 8, 4 and 1 byte steps
+    for (; (end - ptr) >= 8; ptr += 8)
+    {
+        memcpy(&lane, ptr, 8);
+        lane *= GUI_XXH_PRIME64_2;
+        hash ^= GUI_XXH_ROTL64(lane, 31)*GUI_XXH_PRIME64_1;
+        hash = GUI_XXH_ROTL64(hash, 27)*GUI_XXH_PRIME64_1 + GUI_XXH_PRIME64_4;
+    }
+
+    if ((end - ptr) >= 4)
+    {
+        unsigned int value = 0;
+        memcpy(&value, ptr, 4);
+        hash ^= (unsigned long long)value*GUI_XXH_PRIME64_1;
+        hash = GUI_XXH_ROTL64(hash, 23)*GUI_XXH_PRIME64_2 + GUI_XXH_PRIME64_3;
+        ptr += 4;
+    }
+
+    for (; ptr < end; ptr++)
+    {
+        hash ^= (*ptr)*GUI_XXH_PRIME64_5;
+        hash = GUI_XXH_ROTL64(hash, 11)*GUI_XXH_PRIME64_1;
+    }
+
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= GUI_XXH_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= GUI_XXH_PRIME64_3;
+    hash ^= hash >> 32;
+
+    #undef GUI_XXH_PRIME64_1
+    #undef GUI_XXH_PRIME64_2
+    #undef GUI_XXH_PRIME64_3
+    #undef GUI_XXH_PRIME64_4
+    #undef GUI_XXH_PRIME64_5
+    #undef GUI_XXH_ROTL64
+
+    return hash;
+}
+
+// Load style properties records (8 bytes per property), any file version
+// NOTE: Compact properties section (PRPC) is decoded into records, same as PROP section data
+// NOTE: Returned data must be freed by user (RAYGUI_FREE)
+unsigned char *GuiLoadStyleProps(const unsigned char *fileData, int dataSize, int *propertyCount)
+{
+    unsigned char *propsData = NULL;
+    int propsDataSize = 0;
+    short version = 0;
+    int count = 0;
+
+    *propertyCount = 0;
+    if ((fileData == NULL) || (dataSize < 12)) return NULL;
+
+    memcpy(&version, fileData + 4, sizeof(short));
+    memcpy(&count, fileData + 8, sizeof(int));
+
+    if (version >= 700)
+    {
+        GuiStyleSection section = GuiGetStyleSection(fileData, dataSize, "PROP");
+
+        if (section.data != NULL) propsData = GuiLoadStyleSectionData(section, &propsDataSize);
+        else propsData = GuiLoadStylePropsCompact(fileData, dataSize, &propsDataSize);
+    }
+    else if ((count > 0) && (count <= (dataSize - 12)/8))
+    {
+        propsDataSize = count*8;
+        propsData = (unsigned char *)RAYGUI_CALLOC(propsDataSize, sizeof(unsigned char));
+        memcpy(propsData, fileData + 12, propsDataSize);
+    }
+
+    if (propsData != NULL) *propertyCount = propsDataSize/8;
+
+    return propsData;
+}
+
+// Load style from memory with font texture loaded
+// NOTE: Style properties are applied, font is not set as gui font (glyphCount = 0 if not available),
+// returns false if style font texture could not be loaded
+static bool GuiLoadStyleFont(const unsigned char *fileData, int dataSize, GuiStyleFont *styleFont)
+{
+    bool result = true;
+    Image imFont = { 0 };
+
+    memset(styleFont, 0, sizeof(GuiStyleFont));
+
+    // Load style properties and font data (CPU-side)
+    GuiLoadStyleFromMemoryEx(fileData, dataSize, &styleFont->font, &imFont, &styleFont->whiteRec);
+    memcpy(styleFont->name, guiFontName, 32);
+
+    if (imFont.data != NULL)
+    {
+#if defined(RAYGUI_FONT_ICONS_BAKING)
+        // Font atlas image icons baking
+        Rectangle updatedWhiteRec = { 0 };
+        styleFont->iconFontOffsetY = GuiFontIconBaking(&imFont, styleFont->font, &updatedWhiteRec);
+        if (styleFont->iconFontOffsetY > 0) styleFont->whiteRec = updatedWhiteRec;
+#endif
+
+#if !defined(RAYGUI_STANDALONE)
+        // Load texture from image
+        RAYGUI_PROFILE_BEGIN(TEXTURE_CREATE);
+        styleFont->font.texture = LoadTextureFromImage(imFont);
+        RAYGUI_PROFILE_END(TEXTURE_CREATE, GetPixelDataSize(imFont.width, imFont.height, imFont.format));
+
+        if (styleFont->font.texture.id == 0)
+        {
+            RAYGUI_FREE(styleFont->font.recs);
+            RAYGUI_FREE(styleFont->font.glyphs);
+            memset(&styleFont->font, 0, sizeof(Font));
+            result = false;
+        }
+#endif
+        RAYGUI_FREE(imFont.data);
+    }
+
+    return result;
+}
+
+// Set style font as gui font
+// NOTE: Font texture source rectangle is used as white texture to draw shapes,
+// it makes possible to draw shapes and text (full UI) in a single draw call
+static void GuiSetStyleFont(const GuiStyleFont *styleFont)
+{
+    // GLOBAL: Copy font file name into guiFontName
+    memcpy(guiFontName, styleFont->name, 32);
+    guiIconFontOffsetY = styleFont->iconFontOffsetY;
+
+    if ((styleFont->whiteRec.x > 0) &&
+        (styleFont->whiteRec.y > 0) &&
+        (styleFont->whiteRec.width > 0) &&
+        (styleFont->whiteRec.height > 0)) SetShapesTexture(styleFont->font.texture, styleFont->whiteRec);
+
+    GuiSetFont(styleFont->font);
+}
+
+// Unload style font
+// NOTE: Font is not unloaded if currently in use, ownership moved to gui font
+// (it will be unloaded by GuiLoadStyleDefault() as any other loaded font)
+static void GuiUnloadStyleFont(GuiStyleFont *styleFont)
+{
+    if ((styleFont->font.glyphCount > 0) && (styleFont->font.texture.id != guiFont.texture.id))
+    {
+        UnloadTexture(styleFont->font.texture);
+        RAYGUI_FREE(styleFont->font.recs);
+        RAYGUI_FREE(styleFont->font.glyphs);
+    }
+
+    memset(styleFont, 0, sizeof(GuiStyleFont));
+}
+
+// Check if font is owned by styles cache or style bundle
+static bool GuiIsStyleFontShared(Font font)
+{
+    if (font.texture.id == 0) return false;
+
+    for (int i = 0; i < guiStyleBundleFontCount; i++)
+    {
+        if (guiStyleBundleFonts[i].font.texture.id == font.texture.id) return true;
+    }
+
+#if defined(RAYGUI_STYLE_CACHE)
+    for (int i = 0; i < RAYGUI_STYLE_CACHE_SIZE; i++)
+    {
+        if ((guiStyleCache[i].hash != 0) && (guiStyleCache[i].font.font.texture.id == font.texture.id)) return true;
+    }
+#endif
+
+    return false;
+}
+
+#if defined(RAYGUI_STYLE_CACHE)
+// Unload style cache entry
+// NOTE: Entry font is not unloaded if currently in use
+static void GuiUnloadStyleCacheEntry(GuiStyleCacheEntry *entry)
+{
+    if (entry->hash == 0) return;
+
+    RAYGUI_FREE(entry->propsData);
+    GuiUnloadStyleFont(&entry->font);
+
+    memset(entry, 0, sizeof(GuiStyleCacheEntry));
+}
+#endif
+
+#if defined(RAYGUI_SUPPORT_MMAP)
+// Load binary style file memory mapped
+// NOTE: File is opened once and style data is parsed in place from the mapping,
+// returns false if file is a text style (first char '#') or it can not be mapped
+static bool GuiLoadStyleMapped(const char *fileName)
+{
+    bool loaded = false;
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat fileStat = { 0 };
+
+        if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0) && (fileStat.st_size <= 0x7fffffff))
+        {
+            unsigned char *fileData = (unsigned char *)mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (fileData != MAP_FAILED)
+            {
+                if (fileData[0] != '#')
+                {
+                    GuiLoadStyleFromMemory(fileData, (int)fileStat.st_size);
+                    loaded = true;
+                }
+
+                munmap(fileData, (size_t)fileStat.st_size);
+            }
+        }
+
+        close(fd);
+    }
+
+    return loaded;
+}
+#endif
+
 // Split controls text into multiple strings
 // NOTE: Re-used by GuiToggleSlider(), GuiComboBox(), GuiDropdownBox(), GuiListView(), GuiMessageBox(), GuiInputBox()
 static char **GuiTextSplit(const char *text, char delimiter, int *count)
@@ -13,6 +13,9 @@
 *       - Embed style as custom rGSf png chunk (rgs file data)
 *       - Import, configure and preview style fonts (.ttf/.otf)
 *       - Color palette for quick color save/selection
+*       - Command-line batch conversion of multiple styles using a parallel workers pool
+*       - Command-line server mode for conversion requests (JSON lines over stdin/stdout)
+*       - Command-line watch mode, changed styles automatically re-exported
 *       - 12 custom style examples included
 *
 *   LIMITATIONS:
@@ -144,6 +147,30 @@
     #include <emscripten/emscripten.h>      // Emscripten library - LLVM to JavaScript compiler
 #endif
 
+// Conversion stages profiling (command line --profile)
+// NOTE: Stages defined before raygui implementation, required by raygui style loading profiling hooks
+typedef enum {
+    PROFILE_FILE_READ = 0,      // Input files read (style, font, charset)
+    PROFILE_HEADER_PARSE,       // Style header parse (text style lines tokenizing)
+    PROFILE_PROPS_APPLY,        // Style properties apply (GuiSetStyle())
+    PROFILE_ATLAS_INFLATE,      // Font atlas image data decompression
+    PROFILE_GLYPHS_INFLATE,     // Font recs and glyphs data decompression
+    PROFILE_FONT_GENERATION,    // Font atlas generation (text style)
+    PROFILE_TEXTURE_CREATE,     // Font texture creation (table image)
+    PROFILE_TABLE_RENDER,       // Controls table rendering (table image)
+    PROFILE_PROPS_DIFF,         // Style properties diff vs default style (SaveStyleToMemory())
+    PROFILE_DEFLATE,            // Data compression (DEFLATE)
+    PROFILE_LZ4,                // Data compression (LZ4)
+    PROFILE_FILE_WRITE,         // Output file write (including code/text/png encoding)
+    PROFILE_STAGE_COUNT
+} ProfileStage;
+
+static void ProfileStageBegin(int stage);                   // Begin profiling stage
+static void ProfileStageEnd(int stage, int bytes);          // End profiling stage, accumulating time and processed bytes
+
+#define RAYGUI_PROFILE_BEGIN(stage)         ProfileStageBegin(PROFILE_##stage)
+#define RAYGUI_PROFILE_END(stage, bytes)    ProfileStageEnd(PROFILE_##stage, bytes)
+
 #define RAYGUI_IMPLEMENTATION
 #include "external/raygui.h"                // Required for: immediate-mode gui controls
 
@@ -164,6 +191,17 @@
 #define GUI_FILE_DIALOGS_IMPLEMENTATION
 #include "gui_file_dialogs.h"               // GUI: File Dialogs
 
+// Style templates font setup functions, redirected to capture font data CPU-side if required
+// NOTE: Templates loading code calls raylib/raygui font functions that require a GPU context,
+// on command line templates export font atlas image and font data are kept CPU-side (no window)
+static Texture2D LoadStyleTemplateTexture(Image image);    // Load style template font texture, atlas image kept CPU-side if required
+static void SetStyleTemplateFont(Font font);                // Set style template font, font data kept CPU-side if required
+static void SetStyleTemplateShapesTexture(Texture2D texture, Rectangle source); // Set style template shapes texture, white rectangle kept if required
+
+#define LoadTextureFromImage(image)         LoadStyleTemplateTexture(image)
+#define GuiSetFont(font)                    SetStyleTemplateFont(font)
+#define SetShapesTexture(texture, source)   SetStyleTemplateShapesTexture(texture, source)
+
 // raygui embedded styles (used as templates)
 // NOTE: Included in the same order as selector
 #define MAX_GUI_STYLES_AVAILABLE    20      // WARNING: Required for styleNames[]
@@ -187,6 +225,10 @@
 #include "styles/style_advance.h"           // raygui style: advance
 #include "styles/style_turbo.h"             // raygui style: turbo
 
+#undef LoadTextureFromImage
+#undef GuiSetFont
+#undef SetShapesTexture
+
 #define RPNG_IMPLEMENTATION
 #include "external/rpng.h"                  // PNG chunks management
 
@@ -194,6 +236,21 @@
 #include <stdlib.h>                         // Required for: calloc(), free()
 #include <string.h>                         // Required for: strcmp(), memcpy()
 #include <stdio.h>                          // Required for: fopen(), fclose(), fread()...
+#include <time.h>                           // Required for: clock_gettime(), clock()
+
+#if defined(PLATFORM_DESKTOP) && !defined(_WIN32)
+    #include <unistd.h>                     // Required for: fork(), pipe(), read(), write(), close(), sysconf()
+    #include <sys/wait.h>                   // Required for: wait()
+    #include <poll.h>                       // Required for: poll()
+    #include <sys/stat.h>                   // Required for: stat(), fstat()
+#endif
+#if defined(PLATFORM_DESKTOP) && defined(__linux__)
+    #include <sys/inotify.h>                // Required for: inotify_init(), inotify_add_watch()
+#endif
+#if defined(PLATFORM_DESKTOP) && defined(_WIN32)
+    #include <io.h>                         // Required for: _setmode(), _fileno()
+    #include <fcntl.h>                      // Required for: _O_BINARY
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -211,6 +268,9 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
     #define LOG(...)
 #endif
 
+// Compilation time check, used to check tool properties lists sizes against raygui public enums
+#define TOOL_STATIC_CHECK(condition, check) typedef char toolStaticCheck##check[(condition)? 1 : -1]
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -225,6 +285,15 @@ typedef enum {
     STYLE_TEXT              // Style text file (.rgs), only supported on command-line
 } GuiStyleFileType;
 
+// Style as code data emission mode (font atlas data)
+// NOTE: Arrays of hexadecimal values are slow to write and compile for big fonts (i.e. CJK),
+// string literals and C23 #embed are much denser alternatives
+typedef enum {
+    CODE_DATA_ARRAY = 0,    // Data as hexadecimal values array (default)
+    CODE_DATA_STRING,       // Data as string literal (octal escaped)
+    CODE_DATA_EMBED         // Data saved to companion binary file (.bin), included with C23 #embed
+} GuiStyleCodeDataMode;
+
 enum TableControlType {
     TYPE_LABEL = 0,
     TYPE_BUTTON,
@@ -255,6 +324,50 @@ typedef struct PropertyDesc {
     char state[64];   // ToggleGroup state / Slider Min-Max values
 } PropertyDesc;
 
+// Batch conversion result for one file
+// NOTE: Sent from worker processes to main process, size must be lower than PIPE_BUF
+typedef struct StyleBatchResult {
+    int index;              // Input file index
+    int inputSize;          // Input file size (bytes)
+    int outputSize;         // Output file size (bytes), 0 on failure
+    float time;             // Conversion time (seconds)
+} StyleBatchResult;
+
+// Style property edit (command line --edit-prop)
+// NOTE: Same layout as binary style property record
+typedef struct StylePropEdit {
+    short controlId;        // Control id
+    short propertyId;       // Property id
+    int propertyValue;      // Property value
+} StylePropEdit;
+
+// Profiling stage data
+typedef struct ProfileStageData {
+    double time;            // Accumulated time (seconds)
+    long long bytes;        // Accumulated processed bytes
+    int calls;              // Stage calls count
+    double startTime;       // Current stage start time
+} ProfileStageData;
+
+// Watched style file (watch mode)
+// NOTE: Text styles reference external font and charset files, changes on those files also require rebuild
+typedef struct StyleWatchEntry {
+    char fileName[512];         // Style file path (.rgs)
+    char fontFileName[512];     // Referenced font file path (text style only)
+    char charsetFileName[512];  // Referenced charset file path (text style only)
+    unsigned long long hash;    // Content hash: style file + referenced font and charset files
+    long modTime;               // Last modification time: style file + referenced files (polling fallback)
+    bool dirty;                 // Flag to check content hash on next rebuild
+} StyleWatchEntry;
+
+// Text buffer, grown as required
+// NOTE: Used to build text files in memory, written with a single call
+typedef struct TextBuffer {
+    char *data;                 // Text data (NULL-terminated)
+    int length;                 // Text length (bytes)
+    int capacity;               // Text data capacity (bytes)
+} TextBuffer;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -264,7 +377,8 @@ static const char *toolDescription = TOOL_DESCRIPTION;
 
 // Controls name text
 // NOTE: Some styles are shared by multiple controls
-static char *guiControlText[RAYGUI_MAX_CONTROLS] = {
+// WARNING: Controls and properties names must match raygui enums, lists sizes checked on compilation
+static char *guiControlText[] = {
     "DEFAULT",
     "LABEL",        // LABELBUTTON
     "BUTTON",
@@ -322,6 +436,10 @@ static PropertyDesc guiPropsDefaultExtended[] = {
     { "TEXT_WRAP_MODE", PROPERTY_TYPE_STATE, "#107#NO WRAP;#104#CHAR WRAP;#105#WORD WRAP" }, // Toggle values: 0-None, 1-Char, 2-Word
 };
 
+TOOL_STATIC_CHECK(sizeof(guiControlText)/sizeof(char *) == (STATUSBAR + 1), Controls);
+TOOL_STATIC_CHECK(sizeof(guiProps)/sizeof(PropertyDesc) == (TEXT_ALIGNMENT + 1), Props);
+TOOL_STATIC_CHECK(sizeof(guiPropsDefaultExtended)/sizeof(PropertyDesc) == (TEXT_WRAP_MODE - TEXT_SIZE + 1), PropsDefaultExt);
+
 // Toggle extended properties
 static PropertyDesc guiPropsToggleExtended[] = {
     { "GROUP_PADDING", PROPERTY_TYPE_INT, { 0, 16 }},
@@ -488,13 +606,35 @@ static unsigned int loadedStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAY
 
 static bool fontEmbeddedChecked = true;         // Select to embed font into style file
 static bool fontDataCompressedChecked = true;   // Export font data compressed (recs and glyphs)
+static int fontDataCodec = STYLE_CODEC_DEFLATE; // Font data compression codec: DEFLATE (ratio) or LZ4 (speed) (command line --codec)
+static int codeDataMode = CODE_DATA_ARRAY;      // Style as code font data emission mode: array, string or embed (command line --code-data)
+static bool codeStyleResolved = false;          // Style as code exports full style data array, loaded with one copy (command line --code-resolved)
+static bool styleTemplateHeadless = false;      // Style templates font data captured CPU-side on loading (command line templates export)
+static int styleRgsVersion = 700;               // Binary style file version saved: 700 (sections) or 600 (raygui 4.0) (command line --rgs-version)
+static bool styleUpgradeMode = false;           // Upgrade legacy binary styles instead of converting (command line --upgrade)
+static StylePropEdit *stylePropEdits = NULL;    // Properties edits to patch binary styles (command line --edit-prop)
+static int stylePropEditsCount = 0;             // Properties edits count
 
 static int styleFontSelected = -1;              // Style font selected on list view (Default: no-font)
 static Rectangle fontWhiteRec = { 0 };          // Font white rectangle, required to be updated from window font atlas
+static Image customFontAtlas = { 0 };           // Custom font atlas image, CPU-side (command line mode, no GPU required)
+static unsigned char *fontAtlasCompData = NULL; // Font atlas compressed data, shared by exporters (computed once per atlas)
+static int fontAtlasCompDataSize = 0;           // Font atlas compressed data size
+static unsigned long long fontAtlasCompDataHash = 0; // Font atlas data hash, used to check if compressed data is valid
 
 static char currentStyleName[32] = { 0 };       // Current style name
 
-static bool automaticStylesExport = false;
+static bool profileEnabled = false;             // Conversion stages profiling enabled (command line --profile)
+static ProfileStageData profileStages[PROFILE_STAGE_COUNT] = { 0 };  // Profiling data, current file
+static ProfileStageData profileTotals[PROFILE_STAGE_COUNT] = { 0 };  // Profiling data, all files
+static int profileFileCount = 0;                // Profiled files count
+static FILE *profileCsvFile = NULL;             // Profiling CSV report file (optional)
+static int profileStack[16] = { 0 };            // Profiling stages stack, nested stages time excluded from parent
+static int profileStackCount = 0;               // Profiling stages stack count
+static const char *profileStageNames[PROFILE_STAGE_COUNT] = {
+    "file_read", "header_parse", "props_apply", "atlas_inflate", "glyphs_inflate", "font_generation",
+    "texture_create", "table_render", "props_diff", "deflate", "lz4", "file_write"
+};
 
 // NOTE: Max length depends on OS, in Windows MAX_PATH = 256
 static char inFileName[512] = { 0 };            // Input file name (required in case of drag & drop over executable)
@@ -508,13 +648,49 @@ static bool outputFileCreated = false;          // Flag to detect if an output f
 //----------------------------------------------------------------------------------
 #if defined(PLATFORM_DESKTOP)
 static void ShowCommandLineInfo(void);                      // Show command line usage info
-static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+static int ProcessCommandLine(int argc, char *argv[]);      // Process command line input, returns exit status (0 on success)
+
+// Batch conversion functions (command line)
+static void AddBatchInputFiles(FilePathList *files, const char *path); // Add input files from path (file, directory, pattern or @list)
+static int ConvertStyleFile(const char *inFile, const char *outFile, int formatFlags); // Convert one style file to multiple formats, returns output size (0 on failure)
+static int ExportStyleFile(const char *fileName, int format); // Export currently loaded style to file, returns output size (0 on failure)
+static unsigned char *LoadStdinData(int *dataSize);         // Load all data available from stdin (until EOF)
+static int PatchStyleFile(const char *inFile, const char *outFile, const StylePropEdit *edits, int editsCount); // Patch binary style file properties, returns output size (0 on failure)
+static int ConvertStyleFilesBatch(FilePathList files, const char *outPath, int formatFlags, int jobs); // Convert multiple style files using a worker pool, returns converted files count
+static void ServeStyleRequests(void);                        // Serve conversion requests from stdin (JSON lines), results to stdout
+static void WatchStyleFiles(const char *dirPath, const char *outPath, int formatFlags); // Watch directory style files and re-export changed ones
+static unsigned long long ComputeStyleWatchHash(StyleWatchEntry *entry); // Compute style content hash, updates referenced files (watch and serve modes)
+static int ExportStyleTemplate(int index, const char *outPath, int formatFlags); // Export style template to output directory, returns output size (0 on failure)
+static int ExportStyleTemplatesBatch(const char *outPath, int formatFlags, int jobs); // Export all style templates using a worker pool, returns exported templates count
+static void LoadStyleTemplateExport(int index);             // Load style template with font data CPU-side for exporters (no GPU required)
+static Image GenImageStyleTableExport(const char *styleName); // Generate controls table image for loaded style, hidden window created if required
+static int SaveStyleBundle(const char *fileName, FilePathList files); // Save styles bundle file (.rgsb), templates bundled if no files provided, returns output size (0 on failure)
 #endif
 
 // Load/Save/Export data functions
 static int SaveStyle(const char *fileName, int format);     // Save style binary file binary (.rgs)
 static char *SaveStyleToMemory(int *size);                  // Save style to memory buffer
+static char *SaveStyleSectionsToMemory(const GuiStyleSection *sections, int sectionCount, int *size); // Save style sections to memory buffer (v700)
+static char *SaveStyleLegacyToMemory(const unsigned char *propsData, int propertyCount, int *size); // Save style properties and font to memory buffer (v600)
+static GuiStyleSection EncodeStylePropsSection(const unsigned char *propsData, int propertyCount, unsigned char **compactData); // Encode style properties section, compact if possible (v700)
+static unsigned char *UpgradeStyleFromMemory(const unsigned char *fileData, int dataSize, int *upgradedDataSize); // Upgrade legacy binary style data to current version
+static int UpgradeStyleFile(const char *inFile, const char *outFile); // Upgrade legacy binary style file, returns output size (0 on failure)
+static unsigned char *PatchStyleFromMemory(const unsigned char *fileData, int dataSize, const StylePropEdit *edits, int editsCount, int *patchedDataSize); // Patch binary style properties, font data copied
 static void ExportStyleAsCode(const char *fileName, const char *styleName); // Export gui style as properties array
+static void WriteStyleCodeData(FILE *file, const char *fileName, const char *dataName, const char *dataSizeText, const unsigned char *data, int dataSize); // Write style as code data array, using data emission mode
+
+static bool LoadStyleHeadless(const char *fileName);        // Load style file (text or binary) with font data CPU-side (no GPU required), returns false if not valid
+static bool LoadStyleHeadlessFromMemory(const unsigned char *fileData, int fileDataSize, const char *basePath); // Load style from memory with font data CPU-side, returns false if not valid
+static bool IsStyleDataValid(const unsigned char *fileData, int dataSize, bool *fontProvided); // Check binary style data structure is valid (any version), no data decoding
+static void UnloadStyleHeadless(void);                      // Unload style font data loaded CPU-side
+static void LoadStyleTemplate(int index);                   // Load style template (embedded code) into guiStyle, including font
+static Image LoadCustomFontAtlasImage(void);                // Load custom font atlas image (CPU-side copy if available)
+static const unsigned char *GetFontAtlasCompressedData(Image atlas, int *compDataSize); // Get font atlas compressed data (DEFLATE), shared by exporters
+static unsigned char *EncodeFontAtlasData(Image atlas, int *bpp, int *dataSize); // Encode font atlas data with reduced bit-depth (alpha only), if lossless
+static bool IsFontGlyphsDataPackable(Font font);            // Check font recs and glyphs data fit 16-bit packed sections
+static unsigned char *CompressSectionData(const unsigned char *data, int dataSize, int codec, int *compDataSize); // Compress style section data with codec (DEFLATE, LZ4)
+static unsigned char *CompressDataLZ4(const unsigned char *data, int dataSize, int *compDataSize); // Compress data (LZ4 block format), fast decompression
+static const char *GetStyleFileExtension(int format);       // Get style file extension for export format
 
 static void DrawStyleControlsTable(int posX, int posY);     // Draw style controls table
 static Image GenImageStyleControlsTable(int width, int height, const char *styleName); // Generate controls table image
@@ -527,6 +703,18 @@ static Color GuiColorBox(Rectangle bounds, Color *colorPicker, Color color); //
 static int CopyControlProps(PropertyDesc src[], char *names[], int types[], char *states[], int count); // Copy controls data, used on BuildControlPropsText()
 static void BuildControlPropsText(int currentSelectedControl); // Build ListView text for selected control
 
+static double GetTimeStamp(void);                           // Get monotonic time stamp in seconds (no window required)
+static void ProfileFileEnd(const char *fileName);           // End file profiling, data added to totals and CSV report
+static void ShowProfileReport(FILE *output);                // Show profiling report, all files stages totals
+static bool IsFileNameMatch(const char *fileName, const char *pattern); // Check file name matches wildcard pattern (*, ?)
+static int GetJsonValue(const char *json, const char *key, char *value, int valueSize); // Get value from flat JSON object (0 - not found, 1 - string, 2 - other)
+static void PrintJsonString(const char *text);              // Print text as JSON string (quoted and escaped) to stdout
+static void TextBufferAppend(TextBuffer *buffer, const char *text, int length); // Append text to text buffer, buffer grown if required (length -1: NULL-terminated text)
+static void TextBufferAppendProperty(TextBuffer *buffer, int controlId, int propertyId, unsigned int value); // Append style property fields to text buffer: p <controlId> <propertyId> <propertyValue>
+static void TextBufferAppendInteger(TextBuffer *buffer, int value); // Append integer value to text buffer, as decimal text
+static void TextBufferAppendBytesArray(TextBuffer *buffer, const unsigned char *data, int dataSize); // Append bytes to text buffer, as hexadecimal values array
+static void TextBufferAppendBytesString(TextBuffer *buffer, const unsigned char *data, int dataSize); // Append bytes to text buffer, as string literal (octal escaped)
+
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
@@ -542,7 +730,9 @@ int main(int argc, char *argv[])
     {
         if ((argc == 2) &&
             (strcmp(argv[1], "-h") != 0) &&
-            (strcmp(argv[1], "--help") != 0))       // One argument (file dropped over executable?)
+            (strcmp(argv[1], "--help") != 0) &&
+            (strcmp(argv[1], "--serve") != 0) &&
+            (strcmp(argv[1], "--templates") != 0))  // One argument (file dropped over executable?)
         {
             if (IsFileExtension(argv[1], ".rgs"))
             {
@@ -551,8 +741,7 @@ int main(int argc, char *argv[])
         }
         else
         {
-            ProcessCommandLine(argc, argv);
-            return 0;
+            return ProcessCommandLine(argc, argv);
         }
     }
 #endif // PLATFORM_DESKTOP
@@ -1024,34 +1213,6 @@ int main(int argc, char *argv[])
         }
 #endif
 
-#if defined(PLATFORM_DESKTOP) && _DEBUG
-        // Save all style file formats for current style
-        // NOTE: This is a convenience feature to export raygui styles required files
-        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_B))
-        {
-            // Automatic styles export for all available styles
-            automaticStylesExport = true;
-            mainToolbarState.visualStyleActive = 0;
-        }
-
-        if (automaticStylesExport)
-        {
-            // Switch to next style
-            // NOTE: Style export is deferred to the end of the frame to set style and UI
-            mainToolbarState.visualStyleActive++;
-            currentSelectedControl = BUTTON;
-            previousSelectedControl = BUTTON;
-            currentSelectedProperty = BORDER_COLOR_FOCUSED;
-            previousSelectedProperty = 0;
-
-            if (mainToolbarState.visualStyleActive >= MAX_GUI_STYLES_AVAILABLE)
-            {
-                mainToolbarState.visualStyleActive = 0;
-                automaticStylesExport = false;
-            }
-        }
-#endif
-
         // New style file, previous in/out files registeres are reseted
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_N)) || mainToolbarState.btnNewFilePressed)
         {
@@ -1222,34 +1383,9 @@ int main(int argc, char *argv[])
             //currentSelectedControl = -1;
             currentSelectedProperty = -1;
 
-            // Reset to default internal style
-            // NOTE: Required to unload any previously loaded font texture
-            GuiLoadStyleDefault();
-
-            // Load style into guiStyle
-            switch (mainToolbarState.visualStyleActive)
-            {
-                case 1: GuiLoadStyleJungle(); break;
-                case 2: GuiLoadStyleCandy(); break;
-                case 3: GuiLoadStyleLavanda(); break;
-                case 4: GuiLoadStyleCyber(); break;
-                case 5: GuiLoadStyleTerminal(); break;
-                case 6: GuiLoadStyleAshes(); break;
-                case 7: GuiLoadStyleBluish(); break;
-                case 8: GuiLoadStyleDark(); break;
-                case 9: GuiLoadStyleCherry(); break;
-                case 10: GuiLoadStyleSunny(); break;
-                case 11: GuiLoadStyleEnefete(); break;
-                case 12: GuiLoadStyleAmber(); break;
-                case 13: GuiLoadStyleRLTech(); break;
-                case 14: GuiLoadStyleGenesis(); break;
-                case 15: GuiLoadStyleWisteria(); break;
-                case 16: GuiLoadStylePocket(); break;
-                case 17: GuiLoadStyleBrick(); break;
-                case 18: GuiLoadStyleAdvance(); break;
-                case 19: GuiLoadStyleTurbo(); break;
-                default: break;
-            }
+            // Load style template into guiStyle
+            // NOTE: Default style is loaded first, required to unload any previously loaded font texture
+            LoadStyleTemplate(mainToolbarState.visualStyleActive);
 
             // Reset current style backup for changes tracking
             memcpy(loadedStyle, guiStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
@@ -2040,63 +2176,13 @@ int main(int argc, char *argv[])
             }
             //----------------------------------------------------------------------------------------
 
-#if defined(PLATFORM_DESKTOP) && _DEBUG
-            // Automated styles export system, traverses all available styles and exports all required data for all them
-            // NOTE: Exported data is directly placed on raygui required directory, my platform-dependant!
-            if (automaticStylesExport)
-            {
-                const char *styleExportPath = "C:/GitHub/raygui/styles";
-
-                char styleNameLower[64] = { 0 };
-                strcpy(styleNameLower, TextToLower(currentStyleName));
-                if (!DirectoryExists(TextFormat("%s/%s", styleExportPath, styleNameLower)))
-                    MakeDirectory(TextFormat("%s/%s", styleExportPath, styleNameLower));
-
-                // Style header: style_<name>.h
-                ExportStyleAsCode(TextFormat("%s/%s/style_%s.h", styleExportPath, styleNameLower, styleNameLower), currentStyleName);
-                // Copy .h to raygui/eexamples/styles/ and rguistyler/src/styles/
-                FileCopy(TextFormat("%s/%s/style_%s.h", styleExportPath, styleNameLower, styleNameLower),
-                    TextFormat("%s/../examples/styles/style_%s.h", styleExportPath, styleNameLower));
-                FileCopy(TextFormat("%s/%s/style_%s.h", styleExportPath, styleNameLower, styleNameLower),
-                    TextFormat("%s/styles/style_%s.h", GetWorkingDirectory(), styleNameLower));
-
-                // Style binary: style_<name>.rgs
-                SaveStyle(TextFormat("%s/%s/style_%s.rgs", styleExportPath, styleNameLower, styleNameLower), STYLE_BINARY);
-                // Copy .rgs to rguistyler/styles/
-                FileCopy(TextFormat("%s/%s/style_%s.rgs", styleExportPath, styleNameLower, styleNameLower),
-                    TextFormat("%s/../styles/style_%s.rgs", GetWorkingDirectory(), styleNameLower));
-
-                // Style text (font required): style_<name>.rgs.txt
-                SaveStyle(TextFormat("%s/%s/style_%s.rgs.txt", styleExportPath, styleNameLower, styleNameLower), STYLE_TEXT);
-
-                // Style table (with style chunck): style_<name>.png
-                Image imStyleTable = GenImageStyleControlsTable(1920, 256, currentStyleName);
-                ExportImage(imStyleTable, TextFormat("%s/%s/style_%s.png", styleExportPath, styleNameLower, styleNameLower));
-                UnloadImage(imStyleTable);
-                // Write a custom chunk - rGSf (rGuiStyler file)
-                rpng_chunk chunk = { 0 };
-                memcpy(chunk.type, "rGSf", 4); // Chunk type FOURCC
-                chunk.data = SaveStyleToMemory(&chunk.length);
-                rpng_chunk_write(TextFormat("%s/%s/style_%s.png", styleExportPath, styleNameLower, styleNameLower), chunk);
-                RPNG_FREE(chunk.data);
-
-                // Copy font file used (.ttf/.otf)
-                FileCopy(TextFormat("%s/%s", GetWorkingDirectory(), inFontFileName),
-                    TextFormat("%s/%s/%s", styleExportPath, styleNameLower, GetFileName(inFontFileName)));
-
-                // Style screenshot: screenshot.png
-                // NOTE: It required this code to bee deferred and also forcing some batch flushes (OpenGL-related)
-                Image screen = LoadImageFromScreen(); // rlReadScreenPixels() reads back buffer by default (when double-buffering)
-                ExportImage(screen, TextFormat("%s/%s/screenshot.png", styleExportPath, styleNameLower));
-                UnloadImage(screen);
-            }
-#endif
         EndDrawing();
         //----------------------------------------------------------------------------------
     }
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadFont(customFont);     // Unload font data
+    MemFree(fontAtlasCompData); // Unload font atlas compressed data (exporters shared)
 
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -2124,34 +2210,112 @@ static void ShowCommandLineInfo(void)
 
     printf("USAGE:\n\n");
     printf("    > rguistyler [--help] --input <filename.ext> [--output <filename.ext>]\n");
-    printf("                 [--format <styleformat>] [--edit-prop <property> <value>]\n");
+    printf("                 [--format <styleformat>] [--edit-prop <controlId>,<propertyId>,<value>...]\n");
+    printf("    > rguistyler --input <file01.rgs> <file02.rgs> <directory> <pattern> <@list.txt>...\n");
+    printf("                 [--output <directory>] [--format <styleformat>] [--jobs <count>]\n");
+    printf("    > rguistyler --serve\n");
+    printf("    > rguistyler --watch <directory> [--output <directory>] [--format <styleformat>]\n");
+    printf("    > rguistyler --templates [--output <directory>] [--format <styleformat>] [--jobs <count>]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
+    printf("    -i, --input <filename.ext>...   : Define input file(s), use - to read style from stdin.\n");
     printf("                                      Supported extensions: .rgs (text or binary)\n");
-    printf("    -o, --output <filename.ext>     : Define output file.\n");
-    printf("                                      Supported extensions: .rgs, .png, .h\n");
+    printf("                                      NOTE: Multiple inputs enable batch mode, supported inputs:\n");
+    printf("                                          files, directories, patterns (*, ?), lists (@list.txt)\n");
+    printf("    -o, --output <filename.ext>     : Define output file (or output directory in batch mode).\n");
+    printf("                                      Use - to write to stdout (binary .rgs or table .png)\n");
+    printf("                                      Supported extensions: .rgs, .png, .h, .rgsb\n");
+    printf("                                      NOTE: Styles bundle (.rgsb) includes all input styles,\n");
+    printf("                                      font data shared by styles is only stored once\n");
     printf("                                      NOTE: Extension could be modified depending on format\n\n");
-    printf("    -f, --format <type_value>       : Define output file format to export style data.\n");
+    printf("    -f, --format <type_value>,...   : Define output file format(s) to export style data.\n");
     printf("                                      Supported values:\n");
     printf("                                          0 - Style text format (.rgs)  \n");
     printf("                                          1 - Style binary format (.rgs)\n");
     printf("                                          2 - Style as code (.h)\n");
-    printf("                                          3 - Controls table image (.png)\n\n");
-    //printf("    -e, --edit-prop <controlId>,<propertyId>,<propertyValue>\n");
-    //printf("                                    : Edit specific property from input to output.\n");
+    printf("                                          3 - Controls table image (.png)\n");
+    printf("                                      NOTE: Multiple formats separated by comma (1,2,3),\n");
+    printf("                                      style is loaded once and exported to all formats\n\n");
+    printf("    -j, --jobs <count>              : Define batch mode worker processes count.\n");
+    printf("                                      Default: processor cores available\n\n");
+    printf("    -e, --edit-prop <controlId>,<propertyId>,<propertyValue>...\n");
+    printf("                                    : Edit properties from input to output (binary .rgs only),\n");
+    printf("                                      property value as decimal or hexadecimal (0xRRGGBBAA).\n");
+    printf("                                      NOTE: Only properties are rewritten, font data is copied\n\n");
+    printf("    --codec <deflate|lz4>           : Define embedded font data codec (binary .rgs).\n");
+    printf("                                          deflate - Best compression ratio (default)\n");
+    printf("                                          lz4     - Fastest style loading, bigger files\n\n");
+    printf("    --rgs-version <700|600>         : Define binary style file version (binary .rgs).\n");
+    printf("                                          700 - Sections format, requires raygui 5.0 (default)\n");
+    printf("                                          600 - Legacy format, readable by raygui 4.0\n");
+    printf("                                      WARNING: raygui 4.0 can not load v700 styles, use 600\n");
+    printf("                                      NOTE: v600 font data is always compressed with DEFLATE\n\n");
+    printf("    --code-data <array|string|embed>: Define font data emission mode (style as code .h).\n");
+    printf("                                          array  - Hexadecimal values array (default)\n");
+    printf("                                          string - String literal, faster to write and compile\n");
+    printf("                                          embed  - Companion .bin file, included with C23 #embed\n");
+    printf("                                      NOTE: MSVC limits string literals size (64KB), use array\n\n");
+    printf("    --code-resolved                 : Export full style data array (style as code .h), properties\n");
+    printf("                                      resolved on export, loaded with GuiSetStyleData() (one copy).\n");
+    printf("                                      NOTE: Requires raygui 5.0, exported code size is bigger\n\n");
+    printf("    --upgrade                       : Upgrade legacy binary styles (v200-v600) to current version,\n");
+    printf("                                      input files are processed in batch mode (output directory).\n");
+    printf("                                      NOTE: Compressed data is copied, no decompression required\n\n");
+    printf("    --profile [<report.csv>]        : Show conversion stages time and bytes processed,\n");
+    printf("                                      per file stages optionally saved as CSV report.\n");
+    printf("                                      NOTE: Batch mode conversions run on a single process\n\n");
+    printf("    --serve                         : Keep running, read conversion requests from stdin.\n");
+    printf("                                      One JSON object per line, one JSON result line per request:\n");
+    printf("                                          { \"id\": 1, \"input\": \"style.rgs\", \"h\": \"style.h\", \"png\": \"style.png\" }\n");
+    printf("                                      Supported outputs: \"rgs\", \"txt\", \"h\", \"png\"\n");
+    printf("                                      NOTE: Outputs can not be written to stdout (\"-\")\n");
+    printf("                                      NOTE: Send { \"cmd\": \"quit\" } or close stdin to exit\n\n");
+    printf("    --watch <directory>             : Keep running, re-export directory styles (.rgs) on changes.\n");
+    printf("                                      Changes on referenced fonts (.ttf, .otf) and charsets (.txt)\n");
+    printf("                                      also trigger re-export, only styles with changed content\n");
+    printf("                                      are rebuilt. Default output directory: output\n\n");
+    printf("    --templates                     : Export all available style templates (Light, Jungle...),\n");
+    printf("                                      every style to <output>/<name>/style_<name>.<ext>,\n");
+    printf("                                      including font file. Default formats: all (0,1,2,3)\n\n");
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rguistyler --input tools.rgs --output tools.png\n");
+    printf("    > rguistyler --input tools.rgs --output tools --format 1,2,3\n");
+    printf("    > cat tools.rgs.txt | rguistyler --input - --output - --format 1 > tools.rgs\n");
+    printf("    > rguistyler --input themes/ --output themes_code/ --format 2 --jobs 8\n");
+    printf("    > rguistyler --input \"themes/style_*.rgs\" @more_themes.txt --output out/\n");
+    printf("    > rguistyler --serve < requests.jsonl > results.jsonl\n");
+    printf("    > rguistyler --watch themes/ --output themes_code/ --format 2\n");
+    printf("    > rguistyler --input themes/ --output out/ --format 1,2 --profile report.csv\n");
+    printf("    > rguistyler --input legacy_themes/ --output themes/ --upgrade\n");
+    printf("    > rguistyler --templates --output raygui/styles/ --jobs 4\n");
+    printf("    > rguistyler --templates --output themes.rgsb\n");
+    printf("    > rguistyler --input themes/ --output themes.rgsb\n");
+    printf("    > rguistyler --input themes/ --output rebranded/ --edit-prop 0,2,0xff8000ff 1,5,0x202020ff\n");
+    printf("    > rguistyler --input themes/ --output runtime/ --format 1 --codec lz4\n");
+    printf("    > rguistyler --input themes/ --output raygui4_themes/ --format 1 --rgs-version 600\n");
+    printf("    > rguistyler --input cjk_style.rgs --output cjk_style.h --code-data embed\n");
+    printf("    > rguistyler --input themes/ --output themes_code/ --format 2 --code-resolved\n");
 }
 
 // Process command line input
-static void ProcessCommandLine(int argc, char *argv[])
+// NOTE: Exit status is not 0 if any input failed or no valid input was provided
+static int ProcessCommandLine(int argc, char *argv[])
 {
+    int result = 0;                     // Exit status: 0 - success, 1 - any conversion failed
+
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
-    int outputFormat = STYLE_BINARY;    // Formats: STYLE_BINARY, STYLE_AS_CODE, STYLE_TABLE_IMAGE
+    int outputFormatFlags = 0;          // Formats flags: (1 << GuiStyleFileType), multiple formats supported
+    int jobsCount = 0;                  // Batch mode worker processes (0 - processor cores available)
+    bool batchMode = false;             // Batch mode enabled: multiple inputs, directories, patterns or lists
+    bool serveMode = false;             // Server mode enabled: requests read from stdin (JSON lines)
+    bool templatesMode = false;         // Templates mode enabled: all style templates exported
+    char watchDirPath[512] = { 0 };     // Watch mode directory, styles re-exported on changes
+    char profileCsvFileName[512] = { 0 }; // Profiling CSV report file name (optional)
+
+    FilePathList inputFiles = { 0 };    // Input files list (batch mode)
 
     // Process command line arguments
     for (int i = 1; i < argc; i++)
@@ -2163,29 +2327,37 @@ static void ProcessCommandLine(int argc, char *argv[])
         else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
         {
             // Check for valid argument and valid file extension
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            if (((i + 1) < argc) && (strcmp(argv[i + 1], "-") == 0))
             {
-                if (IsFileExtension(argv[i + 1], ".rgs"))
-                {
-                    strcpy(inFileName, argv[i + 1]);    // Read input filename
-                }
-                else LOG("WARNING: Input file extension not recognized\n");
+                strcpy(inFileName, "-");    // Read input style from stdin
 
                 i++;
             }
+            else if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                // Read all input arguments until next option
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+                {
+                    if (IsFileExtension(argv[i + 1], ".rgs") && FileExists(argv[i + 1]) &&
+                        (inputFiles.count == 0) && (inFileName[0] == '\0'))
+                    {
+                        strcpy(inFileName, argv[i + 1]);    // Read input filename
+                    }
+                    else batchMode = true;
+
+                    AddBatchInputFiles(&inputFiles, argv[i + 1]);
+
+                    i++;
+                }
+            }
             else LOG("WARNING: No input file provided\n");
         }
         else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
         {
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            if (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
             {
-                if (IsFileExtension(argv[i + 1], ".rgs") ||
-                    IsFileExtension(argv[i + 1], ".h") ||
-                    IsFileExtension(argv[i + 1], ".png"))
-                {
-                    strcpy(outFileName, argv[i + 1]);   // Read output filename
-                }
-                else LOG("WARNING: Output file extension not recognized\n");
+                // NOTE: Output extension is validated once batch mode is known (directory accepted)
+                strcpy(outFileName, argv[i + 1]);   // Read output filename
 
                 i++;
             }
@@ -2196,761 +2368,3741 @@ static void ProcessCommandLine(int argc, char *argv[])
             // Check for valid argumment and valid parameters
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                int format = TextToInteger(argv[i + 1]);
+                // NOTE: Command line format values order differs from GuiStyleFileType
+                static const int cliFormats[4] = { STYLE_TEXT, STYLE_BINARY, STYLE_AS_CODE, STYLE_TABLE_IMAGE };
+
+                int formatCount = 0;
+                const char **formats = TextSplit(argv[i + 1], ',', &formatCount);
+
+                for (int f = 0; f < formatCount; f++)
+                {
+                    int format = TextToInteger(formats[f]);
 
-                if ((format >= 0) && (format <= 3)) outputFormat = format;
+                    if ((format >= 0) && (format <= 3)) outputFormatFlags |= (1 << cliFormats[format]);
+                    else LOG("WARNING: Format value not valid: %s\n", formats[f]);
+                }
 
                 i++;
             }
             else LOG("WARNING: Format parameters provided not valid\n");
         }
-    }
-
-    if (inFileName[0] != '\0')
-    {
-        // Set a default name for output in case not provided
-        if (outFileName[0] == '\0') strcpy(outFileName, "output");
+        else if ((strcmp(argv[i], "-j") == 0) || (strcmp(argv[i], "--jobs") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                jobsCount = TextToInteger(argv[i + 1]);
 
-        LOG("\nInput file:       %s", inFileName);
-        LOG("\nOutput file:      %s", outFileName);
+                i++;
+            }
+            else LOG("WARNING: Jobs count not provided\n");
+        }
+        else if (strcmp(argv[i], "--serve") == 0)
+        {
+            serveMode = true;
+        }
+        else if ((strcmp(argv[i], "-e") == 0) || (strcmp(argv[i], "--edit-prop") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                // Read all properties edits until next option: <controlId>,<propertyId>,<propertyValue>
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+                {
+                    int valuesCount = 0;
+                    const char **values = TextSplit(argv[i + 1], ',', &valuesCount);
 
-        // Process input .rgs file
-        GuiLoadStyle(inFileName);
+                    if (valuesCount == 3)
+                    {
+                        // NOTE: Property value can be provided as hexadecimal (0xRRGGBBAA) or decimal
+                        StylePropEdit edit = { 0 };
+                        edit.controlId = (short)strtol(values[0], NULL, 10);
+                        edit.propertyId = (short)strtol(values[1], NULL, 10);
+                        edit.propertyValue = (int)strtoul(values[2], NULL, 0);
+
+                        stylePropEdits = (StylePropEdit *)RL_REALLOC(stylePropEdits, (stylePropEditsCount + 1)*sizeof(StylePropEdit));
+                        stylePropEdits[stylePropEditsCount] = edit;
+                        stylePropEditsCount++;
+                    }
+                    else LOG("WARNING: Property edit not valid: %s\n", argv[i + 1]);
 
-        // Export style files with different formats
-        switch (outputFormat)
+                    i++;
+                }
+            }
+            else LOG("WARNING: No property edit provided\n");
+        }
+        else if (strcmp(argv[i], "--codec") == 0)
         {
-            case STYLE_TEXT: SaveStyle(TextFormat("%s%s", outFileName, ".rgs.txt"), outputFormat); break;
-            case STYLE_BINARY: SaveStyle(TextFormat("%s%s", outFileName, ".rgs"), outputFormat); break;
-            case STYLE_AS_CODE: ExportStyleAsCode(TextFormat("%s%s", outFileName, ".h"), GetFileNameWithoutExt(outFileName)); break;
-            case STYLE_TABLE_IMAGE:
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                // Gen and export table image
-                Image imStyleTable = GenImageStyleControlsTable(1920, 256, GetFileNameWithoutExt(outFileName));
-                ExportImage(imStyleTable, TextFormat("%s%s", outFileName, ".png"));
-                UnloadImage(imStyleTable);
-            } break;
-            default: break;
-        }
-    }
+                if (TextIsEqual(TextToLower(argv[i + 1]), "deflate")) fontDataCodec = STYLE_CODEC_DEFLATE;
+                else if (TextIsEqual(TextToLower(argv[i + 1]), "lz4")) fontDataCodec = STYLE_CODEC_LZ4;
+                else LOG("WARNING: Codec not supported: %s\n", argv[i + 1]);
 
-    if (showUsageInfo) ShowCommandLineInfo();
-}
-#endif // PLATFORM_DESKTOP
+                i++;
+            }
+            else LOG("WARNING: Codec not provided\n");
+        }
+        else if (strcmp(argv[i], "--rgs-version") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                int version = TextToInteger(argv[i + 1]);
 
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export data functions
-//--------------------------------------------------------------------------------------------
-// Save current style to memory data array
-// WARNING: Using globals: fontEmbeddedChecked, fontDataCompressed
-static char *SaveStyleToMemory(int *size)
-{
-    #define GUI_STYLE_RGS_VERSION   600
+                if ((version == 600) || (version == 700)) styleRgsVersion = version;
+                else LOG("WARNING: Style version not supported: %s\n", argv[i + 1]);
 
-    // Style File Structure (.rgs)
-    // ------------------------------------------------------
-    // Offset  | Size    | Type       | Description
-    // ------------------------------------------------------
-    // 0       | 4       | char       | Signature: "rGS "
-    // 4       | 2       | short      | Version: 200, 400, 600
-    // 6       | 2       | short      | reserved
-    // 8       | 4       | int        | Num properties (only changed ones from default style)
+                i++;
+            }
+            else LOG("WARNING: Style version not provided\n");
+        }
+        else if (strcmp(argv[i], "--code-data") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (TextIsEqual(TextToLower(argv[i + 1]), "array")) codeDataMode = CODE_DATA_ARRAY;
+                else if (TextIsEqual(TextToLower(argv[i + 1]), "string")) codeDataMode = CODE_DATA_STRING;
+                else if (TextIsEqual(TextToLower(argv[i + 1]), "embed")) codeDataMode = CODE_DATA_EMBED;
+                else LOG("WARNING: Code data mode not supported: %s\n", argv[i + 1]);
 
-    // Properties Data (8 bytes per property)
-    // WARNING: Only properties required that differ from default (light) internal style
-    // foreach (property)
-    // {
-    //   8+8*i  | 2       | short      | ControlId
-    //   8+8*i  | 2       | short      | PropertyId
-    //   8+8*i  | 4       | int        | PropertyValue
-    // }
+                i++;
+            }
+            else LOG("WARNING: Code data mode not provided\n");
+        }
+        else if (strcmp(argv[i], "--code-resolved") == 0)
+        {
+            codeStyleResolved = true;
+        }
+        else if (strcmp(argv[i], "--templates") == 0)
+        {
+            templatesMode = true;
+        }
+        else if (strcmp(argv[i], "--upgrade") == 0)
+        {
+            styleUpgradeMode = true;
+        }
+        else if (strcmp(argv[i], "--profile") == 0)
+        {
+            profileEnabled = true;
 
-    // Custom Font Data : Parameters (64 bytes)
-    // ...     | 4       | int        | Font data size (0 - no font, no more fields added!)
-    // ...     | 32      | char       | Font filename (with extension) - VERSION: >=600
-    // ...     | 4       | int        | Font base size
-    // ...     | 4       | int        | Font glyph count [glyphCount]
-    // ...     | 4       | int        | Font type (0-NORMAL, 1-SDF)
-    // ...     | 16      | Rectangle  | Font white rectangle
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-') && IsFileExtension(argv[i + 1], ".csv"))
+            {
+                strcpy(profileCsvFileName, argv[i + 1]);
 
-    // Custom Font Data : Image (20 bytes + imData)
-    // NOTE: Font image atlas is always converted to GRAY+ALPHA
-    // and atlas image data can be compressed (DEFLATE)
-    // ...     | 4       | int        | Image data size (uncompressed)
-    // ...     | 4       | int        | Image data size (compressed)
-    // ...     | 4       | int        | Image width
-    // ...     | 4       | int        | Image height
-    // ...     | 4       | int        | Image format
-    // ...     | imSize  | byte       | Image data (comp or uncomp)
+                i++;
+            }
+        }
+        else if (strcmp(argv[i], "--watch") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-') && DirectoryExists(argv[i + 1]))
+            {
+                strcpy(watchDirPath, argv[i + 1]);
 
-    // Custom Font Data : Recs (32 bytes*glyphCount)
-    // NOTE: Font recs data can be compressed (DEFLATE)
-    // ...     | 4       | int        | Recs data compressed size (0 - not compressed, 1-compressed) - VERSION: >=400
-    //
-    // if (compRecsSize == 0)
-    // {
-    //    NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
-    //    foreach (glyph)
-    //    {
-    //       ...  | 16      | Rectangle  | Glyph rectangle (in image)
-    //    }
-    // }
-    // else
-    // {
-    //    ...  | compRecsSize | byte  | Rectangles data
-    // }
-    //
+                i++;
+            }
+            else LOG("WARNING: Watch directory not provided or not found\n");
+        }
+    }
 
-    // Custom Font Data : Glyph Info (32 bytes*glyphCount)
-    // NOTE: Font glyphs info data can be compressed (DEFLATE)
-    // ...     | 4       | int        | Glyphs data compressed size (0 - not compressed) - VERSION: >=400
-    //
-    // if (compGlyphsSize == 0)
-    // {
-    //    NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
-    //    foreach (glyph)
-    //    {
-    //      ...   | 4       | int        | Glyph value
-    //      ...   | 4       | int        | Glyph offset X
-    //      ...   | 4       | int        | Glyph offset Y
-    //      ...   | 4       | int        | Glyph advance X
-    //    }
-    // }
-    // else
-    // {
-    //    ...  | compGlyphsSize | byte | Glyphs data
-    // }
-    // ------------------------------------------------------
+    // Default light style backup (used to track changed properties on export)
+    GuiGetStyle(0, 0); // WARNING: Make sure default style is lazy initialized!
+    memcpy(defaultStyle, guiStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
 
-    char *buffer = (char *)RL_CALLOC(1024*1024, 1);  // 1MB should be enough to save the style
-    int dataSize = 0;
+    if (profileEnabled && (profileCsvFileName[0] != '\0'))
+    {
+        profileCsvFile = fopen(profileCsvFileName, "wt");
+        if (profileCsvFile != NULL) fprintf(profileCsvFile, "file,stage,calls,time_ms,bytes\n");
+        else LOG("WARNING: Profile CSV file could not be created\n");
+    }
 
-    char signature[5] = "rGS ";
-    short version = GUI_STYLE_RGS_VERSION;
-    short reserved = 0;
-    int changedPropCounter = 0; // WARNING: Filled along the check, saved later
+    if (serveMode)
+    {
+        ServeStyleRequests();
+    }
+    else if (IsFileExtension(outFileName, ".rgsb") && (templatesMode || (inputFiles.count > 0)))
+    {
+        // NOTE: Styles bundle from input files or style templates (no input files)
+        if (SaveStyleBundle(outFileName, templatesMode? (FilePathList){ 0 } : inputFiles) == 0) result = 1;
+    }
+    else if (templatesMode)
+    {
+        // NOTE: All formats exported by default, as required by raygui styles repository
+        int exportedCount = ExportStyleTemplatesBatch(outFileName, (outputFormatFlags == 0)? 0x0f : outputFormatFlags, profileEnabled? 1 : jobsCount);
+        if (exportedCount < MAX_GUI_STYLES_AVAILABLE) result = 1;
+    }
+    else if (watchDirPath[0] != '\0')
+    {
+        WatchStyleFiles(watchDirPath, outFileName, (outputFormatFlags == 0)? (1 << STYLE_BINARY) : outputFormatFlags);
+    }
+    else if (batchMode || (inputFiles.count > 1) || (styleUpgradeMode && (inputFiles.count > 0)))
+    {
+        // NOTE: Profiling requires all conversions on main process
+        int convertedCount = ConvertStyleFilesBatch(inputFiles, outFileName, (outputFormatFlags == 0)? (1 << STYLE_BINARY) : outputFormatFlags, profileEnabled? 1 : jobsCount);
+        if ((inputFiles.count == 0) || (convertedCount < (int)inputFiles.count)) result = 1;
+    }
+    else if (inFileName[0] != '\0')
+    {
+        // Set a default name for output in case not provided
+        if (outFileName[0] == '\0') strcpy(outFileName, "output");
 
-    memcpy(buffer, signature, 4);
-    memcpy(buffer + 4, &version, sizeof(short));
-    memcpy(buffer + 6, &reserved, sizeof(short));
-    memcpy(buffer + 8, &changedPropCounter, sizeof(int)); // WARNING: Updated later!
-    dataSize += 12;
+        if (IsFileExtension(outFileName, ".rgs") ||
+            IsFileExtension(outFileName, ".h") ||
+            IsFileExtension(outFileName, ".png") ||
+            (GetFileExtension(outFileName) == NULL))
+        {
+            // Output format from output file extension, if not provided
+            if (outputFormatFlags == 0)
+            {
+                if (IsFileExtension(outFileName, ".h")) outputFormatFlags = (1 << STYLE_AS_CODE);
+                else if (IsFileExtension(outFileName, ".png")) outputFormatFlags = (1 << STYLE_TABLE_IMAGE);
+                else outputFormatFlags = (1 << STYLE_BINARY);
+            }
 
-    short controlId = 0;
-    short propertyId = 0;
-    int propertyValue = 0;
+            LOG("\nInput file:       %s", inFileName);
+            LOG("\nOutput file:      %s", outFileName);
 
-    // Save all properties that have changed in DEFAULT style
-    for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
-    {
-        if (defaultStyle[i] != GuiGetStyle(0, i))
+            // Process input .rgs file
+            if (ConvertStyleFile(inFileName, outFileName, outputFormatFlags) == 0) result = 1;
+            ProfileFileEnd(inFileName);
+        }
+        else
         {
-            propertyId = (short)i;
-            propertyValue = GuiGetStyle(0, i);
+            LOG("WARNING: Output file extension not recognized\n");
+            result = 1;
+        }
+    }
+    else if (!showUsageInfo)
+    {
+        LOG("WARNING: Input file extension not recognized\n");
+        result = 1;
+    }
 
-            memcpy(buffer + dataSize, &controlId, sizeof(short));
-            memcpy(buffer + dataSize + 2, &propertyId, sizeof(short));
-            memcpy(buffer + dataSize + 4, &propertyValue, sizeof(int));
-            dataSize += 8;
+    // Free input files list
+    for (unsigned int i = 0; i < inputFiles.count; i++) RL_FREE(inputFiles.paths[i]);
+    RL_FREE(inputFiles.paths);
 
-            changedPropCounter++;
-        }
+    if (profileEnabled && (profileFileCount > 0))
+    {
+        // NOTE: Report written to stderr if stdout is used for output data
+        ShowProfileReport((strcmp(outFileName, "-") == 0)? stderr : stdout);
     }
 
-    // Save all properties that have changed in comparison to DEFAULT style
-    for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+    // NOTE: Profile CSV report file is closed even if no file was profiled (header only)
+    if (profileCsvFile != NULL)
     {
-        for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
-        {
-            // NOTE: Check Control property different than default (light) style
-            if (GuiGetStyle(i, j) != defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j])
-            {
-                // Check property is different than its DEFAULT alternative ||
-                // property different than default (light) style DEFAULT alternative
-                if ((GuiGetStyle(i, j) != GuiGetStyle(0, j)) ||
-                    (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != defaultStyle[j]))
-                {
-                    controlId = (short)i;
-                    propertyId = (short)j;
-                    propertyValue = GuiGetStyle(i, j);
+        fclose(profileCsvFile);
+        profileCsvFile = NULL;
+    }
 
-                    memcpy(buffer + dataSize, &controlId, sizeof(short));
-                    memcpy(buffer + dataSize + 2, &propertyId, sizeof(short));
-                    memcpy(buffer + dataSize + 4, &propertyValue, sizeof(int));
-                    dataSize += 8;
+    RL_FREE(stylePropEdits);
+    UnloadStyleHeadless();
+    MemFree(fontAtlasCompData);
+    if (IsWindowReady()) CloseWindow();     // Hidden window only created for table image export
 
-                    changedPropCounter++;
-                }
-            }
-        }
+    if (showUsageInfo) ShowCommandLineInfo();
 
-        // NOTE: Extended properties are not shared beetween controls, they are unique, even DEFAULT ones
-        for (int j = RAYGUI_MAX_PROPS_BASE; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+    return result;
+}
+
+// Add input files from path to list
+// NOTE: Supported paths: file, directory (.rgs files), pattern (*, ?) and list file (@list.txt, one path per line)
+static void AddBatchInputFiles(FilePathList *files, const char *path)
+{
+    if (path[0] == '@')
+    {
+        // Input paths list file, every line can be any supported path
+        char *listText = LoadFileText(path + 1);
+
+        if (listText != NULL)
         {
-            if (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j))
+            char *line = listText;
+
+            while (*line != '\0')
             {
-                controlId = (short)i;
-                propertyId = (short)j;
-                propertyValue = GuiGetStyle(i, j);
+                char *lineEnd = line;
+                while ((*lineEnd != '\0') && (*lineEnd != '\n') && (*lineEnd != '\r')) lineEnd++;
 
-                memcpy(buffer + dataSize, &controlId, sizeof(short));
-                memcpy(buffer + dataSize + 2, &propertyId, sizeof(short));
-                memcpy(buffer + dataSize + 4, &propertyValue, sizeof(int));
-                dataSize += 8;
+                bool lastLine = (*lineEnd == '\0');
+                *lineEnd = '\0';
 
-                changedPropCounter++;
+                // NOTE: Nested lists not supported to avoid recursion loops
+                if ((line[0] != '\0') && (line[0] != '#') && (line[0] != '@')) AddBatchInputFiles(files, line);
+
+                if (lastLine) break;
+                line = lineEnd + 1;
             }
+
+            UnloadFileText(listText);
         }
+        else printf("WARNING: Input list file could not be loaded: %s\n", path + 1);
     }
+    else if ((strchr(path, '*') != NULL) || (strchr(path, '?') != NULL))
+    {
+        // Input file name pattern, only supported for file names (not directories)
+        const char *dirPath = (strchr(path, '/') != NULL)? GetDirectoryPath(path) : ".";
+        char pattern[256] = { 0 };
+        strncpy(pattern, GetFileName(path), 255);
 
-    // Save changed properties count
-    memcpy(buffer + 8, &changedPropCounter, sizeof(int));
+        FilePathList dirFiles = LoadDirectoryFilesEx(dirPath, ".rgs", false);
 
-    int fontSize = 0;
+        for (unsigned int i = 0; i < dirFiles.count; i++)
+        {
+            if (IsFileNameMatch(GetFileName(dirFiles.paths[i]), pattern)) AddBatchInputFiles(files, dirFiles.paths[i]);
+        }
 
-    // Embed font data if required
-    if (fontEmbeddedChecked && customFontLoaded)
+        UnloadDirectoryFiles(dirFiles);
+    }
+    else if (DirectoryExists(path))
     {
-        Image imFont = LoadImageFromTexture(customFont.texture);
+        FilePathList dirFiles = LoadDirectoryFilesEx(path, ".rgs", false);
 
-        // Make sure font atlas image data is GRAY + ALPHA
-        // WARNING: Should RGBA font data be supported?
-        if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+        for (unsigned int i = 0; i < dirFiles.count; i++) AddBatchInputFiles(files, dirFiles.paths[i]);
+
+        UnloadDirectoryFiles(dirFiles);
+    }
+    else if (IsFileExtension(path, ".rgs") && FileExists(path))
+    {
+        if (files->count >= files->capacity)
         {
-            // TODO: For further optimization, GRAYSCALE format can be used,
-            // to be decomposed into 2 channels on loading
-            ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+            files->capacity = (files->capacity == 0)? 256 : files->capacity*2;
+            files->paths = (char **)RL_REALLOC(files->paths, files->capacity*sizeof(char *));
         }
 
-        // Write font parameters
-        // WARNING: VERSION: 600 adds 32 bytes for font filename
-        int fontParamsSize = 32 + ((version >= 600)? 32 : 0);
-        int fontImageUncompSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
-        int fontImageCompSize = fontImageUncompSize;
-        int fontGlyphDataSize = customFont.glyphCount*32;       // 32 bytes by char
-        int fontDataSize = fontParamsSize + fontImageUncompSize + fontGlyphDataSize;
-        int fontType = 0; // 0-NORMAL, 1-SDF
+        files->paths[files->count] = (char *)RL_CALLOC(strlen(path) + 1, 1);
+        strcpy(files->paths[files->count], path);
+        files->count++;
+    }
+    else printf("WARNING: Input file not valid: %s\n", path);
+}
 
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-        // NOTE: If data is compressed using raylib CompressData() DEFLATE,
-        // it requires to be decompressed with raylib DecompressData(), that requires
-        // compiling raylib with SUPPORT_COMPRESSION_API config flag enabled
-        fontImageUncompSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+// Convert one style file (load + export)
+// NOTE: Style is loaded once and exported to all formats requested (1 << GuiStyleFileType),
+// output file extension is replaced depending on format, returns output files total size (0 on failure)
+static int ConvertStyleFile(const char *inFile, const char *outFile, int formatFlags)
+{
+    int outputSize = 0;
+    char outFileBase[512] = { 0 };
 
-        // Compress font atlas image data
-        unsigned char *compData = CompressData(imFont.data, fontImageUncompSize, &fontImageCompSize);
+    bool inputStdin = (strcmp(inFile, "-") == 0);
+    bool outputStdout = (strcmp(outFile, "-") == 0);
 
-        // NOTE: Actually, fontDataSize is only used to check that there is font data included in the file
-        fontDataSize = fontParamsSize + fontImageCompSize + fontGlyphDataSize;
-#endif
-        memcpy(buffer + dataSize, &fontDataSize, sizeof(int));
-        dataSize += 4;
+    if (!inputStdin && !FileExists(inFile)) return 0;
 
-        if (version >= 600)
-        {
-            // Save font filename (32 bytes, with '\0' terminator)
-            char fontName[32] = { 0 };
-            snprintf(fontName, 32, "%s", GetFileName(inFontFileName));
-            if (fontName[0] != '\0') memcpy(buffer + dataSize, fontName, 31);
-            else
-            {
-                strcpy(fontName, "<NO_FONT_NAME>");
-                memcpy(buffer + dataSize, fontName, 31);
-            }
-            dataSize += 32;
-        }
+    // Only one format can be written to stdout
+    if (outputStdout && ((formatFlags & (formatFlags - 1)) != 0))
+    {
+        fprintf(stderr, "WARNING: Only one output format supported when writing to stdout\n");
+        return 0;
+    }
 
-        memcpy(buffer + dataSize, &customFont.baseSize, sizeof(int));
-        memcpy(buffer + dataSize + 4, &customFont.glyphCount, sizeof(int));
-        memcpy(buffer + dataSize + 8, &fontType, sizeof(int));
+    // Remove output file extension (if provided), replaced by every format extension
+    snprintf(outFileBase, 512, "%s", outFile);
+    if (IsFileExtension(outFileBase, ".txt")) outFileBase[strlen(outFileBase) - 4] = '\0';
+    if (IsFileExtension(outFileBase, ".rgs;.h;.png")) *strrchr(outFileBase, '.') = '\0';
 
-        // Save font white rectangle
-        memcpy(buffer + dataSize + 12, &fontWhiteRec, sizeof(Rectangle));
-        dataSize += (12 + sizeof(Rectangle));
+    // Upgrade mode: binary style data rewritten, no style loading required
+    if (styleUpgradeMode) return UpgradeStyleFile(inFile, TextFormat("%s.rgs", outFileBase));
 
-        // Write font image parameters
-        memcpy(buffer + dataSize, &fontImageUncompSize, sizeof(int));
-        memcpy(buffer + dataSize + 4, &fontImageCompSize, sizeof(int));
-        memcpy(buffer + dataSize + 8, &imFont.width, sizeof(int));
-        memcpy(buffer + dataSize + 12, &imFont.height, sizeof(int));
-        memcpy(buffer + dataSize + 16, &imFont.format, sizeof(int));
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-        memcpy(buffer + dataSize + 20, compData, fontImageCompSize);
-        dataSize += (20 + fontImageCompSize);
-        MemFree(compData);
-#else
-        memcpy(buffer + dataSize, imFont.data, fontImageUncompSize);
-        dataSize += (20 + fontImageUncompSize);
-#endif
-        UnloadImage(imFont);
+    // Properties edit mode: binary style properties patched, font data copied (no decoding required)
+    // NOTE: Only binary style output is generated, independently of formats requested
+    if (stylePropEditsCount > 0) return PatchStyleFile(inFile, outputStdout? "-" : TextFormat("%s.rgs", outFileBase), stylePropEdits, stylePropEditsCount);
 
-        // Write font recs data
-        // NOTE: Version 400 always adds the compression size parameter
-        if (version >= 400)
-        {
-            int recsDataCompSize = 0;
+    // Process input .rgs file
+    // NOTE: No GPU required, font atlas is kept CPU-side
+    bool styleLoaded = false;
 
-            if (fontDataCompressedChecked)
-            {
-                unsigned char *recsDataCompressed = CompressData((unsigned char *)customFont.recs, customFont.glyphCount*sizeof(Rectangle), &recsDataCompSize);
+    if (inputStdin)
+    {
+        // Text style font and charset files are loaded relative to working directory
+        int dataSize = 0;
+        unsigned char *data = LoadStdinData(&dataSize);
+        styleLoaded = LoadStyleHeadlessFromMemory(data, dataSize, ".");
+        RL_FREE(data);
+    }
+    else styleLoaded = LoadStyleHeadless(inFile);
+
+    // WARNING: Nothing is exported if input style is not valid, avoids writing default style instead
+    if (!styleLoaded)
+    {
+        fprintf(stderr, "WARNING: Input style not valid: %s\n", inFile);
+        return 0;
+    }
 
-                memcpy(buffer + dataSize, &recsDataCompSize, sizeof(int));
-                dataSize += 4;
+    // NOTE: Formats exported in GuiStyleFileType order, binary style compressed font atlas
+    // is computed first and reused by code export
+    for (int format = STYLE_BINARY; format <= STYLE_TEXT; format++)
+    {
+        if ((formatFlags & (1 << format)) == 0) continue;
 
-                memcpy(buffer + dataSize, recsDataCompressed, recsDataCompSize);
-                dataSize += recsDataCompSize;
+        char outFilePath[512] = { 0 };      // NOTE: TextFormat() static buffers are reused by exporters
+        snprintf(outFilePath, 512, "%s%s", outFileBase, outputStdout? "" : GetStyleFileExtension(format));
 
-                RL_FREE(recsDataCompressed);
-            }
-            else
-            {
-                memcpy(buffer + dataSize, &recsDataCompSize, sizeof(int));
-                dataSize += 4;
+        int size = ExportStyleFile(outFilePath, format);
+        if (size == 0) return 0;
 
-                for (int i = 0; i < customFont.glyphCount; i++)
-                {
-                    memcpy(buffer + dataSize, &customFont.recs[i], sizeof(Rectangle));
-                    dataSize += sizeof(Rectangle);
-                }
-            }
+        outputSize += size;
+    }
+
+    return outputSize;
+}
+
+// Export currently loaded style to file with provided format
+// NOTE: Style name (code and table image) is taken from output file name,
+// file name "-" writes to stdout (binary and table image only), returns output size (0 on failure)
+static int ExportStyleFile(const char *fileName, int format)
+{
+    int outputSize = 0;
+    char styleName[64] = { 0 };
+    bool outputStdout = (strcmp(fileName, "-") == 0);
+
+    if (fileName[0] == '\0') return 0;
+
+    if (outputStdout)
+    {
+        if ((format != STYLE_BINARY) && (format != STYLE_TABLE_IMAGE))
+        {
+            fprintf(stderr, "WARNING: Only binary style and table image can be written to stdout\n");
+            return 0;
         }
-        else
+
+        // WARNING: stdout is used for output data, make sure nothing else is logged
+        SetTraceLogLevel(LOG_NONE);
+#if defined(_WIN32)
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        strcpy(styleName, "style");
+    }
+    else
+    {
+        // NOTE: Extension removed twice in case of text style (.rgs.txt)
+        snprintf(styleName, 64, "%s", GetFileNameWithoutExt(fileName));
+        if (strchr(styleName, '.') != NULL) *strchr(styleName, '.') = '\0';
+    }
+
+    // NOTE: Output write stage includes data encoding, nested stages time (diff, compression...) is excluded
+    ProfileStageBegin(PROFILE_FILE_WRITE);
+
+    // Export style files with different formats
+    switch (format)
+    {
+        case STYLE_TEXT:
+        case STYLE_BINARY:
         {
-            // Fallback for older versions, no compression and no compression size stored
-            for (int i = 0; i < customFont.glyphCount; i++)
+            if (outputStdout)
             {
-                memcpy(buffer + dataSize, &customFont.recs[i], sizeof(Rectangle));
-                dataSize += sizeof(Rectangle);
-            }
-        }
+                // Binary style saved to memory and written to stdout, no temp files required
+                int dataSize = 0;
+                char *data = SaveStyleToMemory(&dataSize);
 
-        // Write font chars info data
-        // NOTE: Version 400 always adds the compression size parameter
-        if (version >= 400)
+                if ((data != NULL) && (fwrite(data, 1, dataSize, stdout) == (size_t)dataSize)) outputSize = dataSize;
+                fflush(stdout);
+
+                RL_FREE(data);
+            }
+            else SaveStyle(fileName, format);
+        } break;
+        case STYLE_AS_CODE: ExportStyleAsCode(fileName, styleName); break;
+        case STYLE_TABLE_IMAGE:
         {
-            int glyphsDataCompSize = 0;
+            // Gen and export table image
+            // NOTE: A hidden window (and OpenGL context) is only created for this format
+            Image imStyleTable = GenImageStyleTableExport(styleName);
 
-            if (fontDataCompressedChecked)
+            if (outputStdout)
             {
-                // NOTE: Only saving some fields from GlyphInfo struct
-                int *glyphsData = (int *)RL_CALLOC(customFont.glyphCount*4, sizeof(int));
+                int dataSize = 0;
+                unsigned char *data = ExportImageToMemory(imStyleTable, ".png", &dataSize);
 
-                for (int i = 0; i < customFont.glyphCount; i++)
-                {
-                    glyphsData[4*i + 0] = customFont.glyphs[i].value;
-                    glyphsData[4*i + 1] = customFont.glyphs[i].offsetX;
-                    glyphsData[4*i + 2] = customFont.glyphs[i].offsetY;
-                    glyphsData[4*i + 3] = customFont.glyphs[i].advanceX;
-                }
+                if ((data != NULL) && (fwrite(data, 1, dataSize, stdout) == (size_t)dataSize)) outputSize = dataSize;
+                fflush(stdout);
 
-                unsigned char *glyphsDataCompressed = CompressData((unsigned char *)glyphsData, customFont.glyphCount*4*sizeof(int), &glyphsDataCompSize);
+                MemFree(data);
+            }
+            else ExportImage(imStyleTable, fileName);
+            UnloadImage(imStyleTable);
+        } break;
+        default: break;
+    }
 
-                memcpy(buffer + dataSize, &glyphsDataCompSize, sizeof(int));
-                dataSize += 4;
+    if (!outputStdout && FileExists(fileName)) outputSize = GetFileLength(fileName);
 
-                memcpy(buffer + dataSize, glyphsDataCompressed, glyphsDataCompSize);
-                dataSize += glyphsDataCompSize;
+    ProfileStageEnd(PROFILE_FILE_WRITE, outputSize);
 
-                RL_FREE(glyphsDataCompressed);
-                RL_FREE(glyphsData);
-            }
-            else
-            {
-                memcpy(buffer + dataSize, &glyphsDataCompSize, sizeof(int));
-                dataSize += 4;
+    return outputSize;
+}
 
-                for (int i = 0; i < customFont.glyphCount; i++)
-                {
-                    memcpy(buffer + dataSize, &customFont.glyphs[i].value, sizeof(int));
-                    memcpy(buffer + dataSize + 4, &customFont.glyphs[i].offsetX, sizeof(int));
-                    memcpy(buffer + dataSize + 8, &customFont.glyphs[i].offsetY, sizeof(int));
-                    memcpy(buffer + dataSize + 12, &customFont.glyphs[i].advanceX, sizeof(int));
-                    dataSize += 16;
-                }
-            }
-        }
-        else
+// Load all data available from stdin
+// NOTE: Data is read in blocks until EOF, returned data must be freed by user (RL_FREE)
+static unsigned char *LoadStdinData(int *dataSize)
+{
+    #define STDIN_READ_BLOCK_SIZE   65536
+
+    unsigned char *data = NULL;
+    int size = 0;
+    int capacity = 0;
+
+#if defined(_WIN32)
+    _setmode(_fileno(stdin), _O_BINARY);
+#endif
+
+    ProfileStageBegin(PROFILE_FILE_READ);
+    while (!feof(stdin) && !ferror(stdin))
+    {
+        if ((capacity - size) < STDIN_READ_BLOCK_SIZE)
         {
-            // Fallback for older versions, no compression and no compression size stored
-            for (int i = 0; i < customFont.glyphCount; i++)
-            {
-                memcpy(buffer + dataSize, &customFont.glyphs[i].value, sizeof(int));
-                memcpy(buffer + dataSize + 4, &customFont.glyphs[i].offsetX, sizeof(int));
-                memcpy(buffer + dataSize + 8, &customFont.glyphs[i].offsetY, sizeof(int));
-                memcpy(buffer + dataSize + 12, &customFont.glyphs[i].advanceX, sizeof(int));
-                dataSize += 16;
-            }
+            capacity = (capacity == 0)? STDIN_READ_BLOCK_SIZE : capacity*2;
+            data = (unsigned char *)RL_REALLOC(data, capacity);
         }
+
+        size += (int)fread(data + size, 1, capacity - size, stdin);
+    }
+    ProfileStageEnd(PROFILE_FILE_READ, size);
+
+    *dataSize = size;
+
+    return data;
+}
+
+// Patch binary style file properties with provided edits
+// NOTE: File name "-" reads from stdin / writes to stdout, returns output size (0 on failure)
+static int PatchStyleFile(const char *inFile, const char *outFile, const StylePropEdit *edits, int editsCount)
+{
+    int outputSize = 0;
+    int fileDataSize = 0;
+    unsigned char *fileData = NULL;
+
+    if (strcmp(inFile, "-") == 0) fileData = LoadStdinData(&fileDataSize);
+    else
+    {
+        ProfileStageBegin(PROFILE_FILE_READ);
+        fileData = LoadFileData(inFile, &fileDataSize);
+        ProfileStageEnd(PROFILE_FILE_READ, fileDataSize);
     }
+
+    ProfileStageBegin(PROFILE_PROPS_APPLY);
+    int patchedDataSize = 0;
+    unsigned char *patchedData = PatchStyleFromMemory(fileData, fileDataSize, edits, editsCount, &patchedDataSize);
+    ProfileStageEnd(PROFILE_PROPS_APPLY, patchedDataSize);
+
+    RL_FREE(fileData);      // NOTE: LoadFileData() and LoadStdinData() use RL_MALLOC/RL_REALLOC
+
+    if (patchedData == NULL) fprintf(stderr, "WARNING: Style file not valid, only binary styles can be patched: %s\n", inFile);
     else
     {
-        memcpy(buffer + dataSize, &fontSize, sizeof(int));
-        dataSize += 4;
+        ProfileStageBegin(PROFILE_FILE_WRITE);
+        if (strcmp(outFile, "-") == 0)
+        {
+#if defined(_WIN32)
+            _setmode(_fileno(stdout), _O_BINARY);
+#endif
+            if (fwrite(patchedData, 1, patchedDataSize, stdout) == (size_t)patchedDataSize) outputSize = patchedDataSize;
+            fflush(stdout);
+        }
+        else if (SaveFileData(outFile, patchedData, patchedDataSize)) outputSize = patchedDataSize;
+        ProfileStageEnd(PROFILE_FILE_WRITE, outputSize);
     }
 
-    *size = dataSize;
-    return buffer;
+    RL_FREE(patchedData);
+
+    return outputSize;
 }
 
-// Save raygui style binary file (.rgs)
-// NOTE: By default style is saved as binary file but
-// a text style mode is also available for debug (no font embedding)
-static int SaveStyle(const char *fileName, int format)
+// Convert multiple style files using a worker pool
+// NOTE: raygui style state is global (guiStyle, guiFont), so workers are processes (fork) instead
+// of threads, files are dispatched on demand through a pipe and results are collected by main process,
+// returns converted files count
+static int ConvertStyleFilesBatch(FilePathList files, const char *outPath, int formatFlags, int jobs)
 {
-    #define GUI_STYLE_RGS_VERSION   600
+    if (files.count == 0)
+    {
+        printf("WARNING: No valid input files provided\n");
+        return 0;
+    }
 
-    int result = 0;
+    // Set a default output directory in case not provided
+    // NOTE: Output files are never saved next to input files, it could overwrite them
+    if (outPath[0] == '\0') outPath = "output";
+    if (!DirectoryExists(outPath)) MakeDirectory(outPath);
 
-    if (format == STYLE_BINARY)
+    // Check output names collisions, output files are named from input file name (no directory)
+    // NOTE: Files with an output name already used by a previous file are not converted (reported as failed),
+    // they would overwrite previous file outputs, names compared by hash first
+    int *tasks = (int *)RL_CALLOC(files.count, sizeof(int));    // Files indices to be converted
+    int *collisions = (int *)RL_CALLOC(files.count, sizeof(int)); // File index with same output name (-1 if none)
+    unsigned long long *namesHash = (unsigned long long *)RL_CALLOC(files.count, sizeof(unsigned long long));
+    int taskCount = 0;
+
+    for (unsigned int i = 0; i < files.count; i++)
     {
-        int rgsFileDataSize = 0;
-        char *rgsFileData = SaveStyleToMemory(&rgsFileDataSize);
+        char fileName[256] = { 0 };
+        snprintf(fileName, 256, "%s", GetFileNameWithoutExt(files.paths[i]));
+        namesHash[i] = GuiComputeDataHash((const unsigned char *)fileName, (int)strlen(fileName), 0);
+        collisions[i] = -1;
 
-        result = SaveFileData(fileName, rgsFileData, rgsFileDataSize);
+        for (int t = 0; t < taskCount; t++)
+        {
+            if ((namesHash[tasks[t]] == namesHash[i]) && TextIsEqual(fileName, GetFileNameWithoutExt(files.paths[tasks[t]]))) { collisions[i] = tasks[t]; break; }
+        }
 
-        RL_FREE(rgsFileData);
+        if (collisions[i] < 0) tasks[taskCount++] = i;
     }
-    else if (format == STYLE_TEXT)
+
+    if (jobs <= 0)
     {
-        FILE *rgsFile = fopen(fileName, "wt");
+#if !defined(_WIN32)
+        jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        if (jobs <= 0) jobs = 1;
+    }
+    if (jobs > taskCount) jobs = (taskCount > 0)? taskCount : 1;
 
-        if (rgsFile != NULL)
-        {
-            // Write some description comments
-            fprintf(rgsFile, "#\n# rgs style text file - raygui style file generated using rGuiStyler\n#\n");
-            fprintf(rgsFile, "# Provided info:\n");
-            fprintf(rgsFile, "#    f <fontGenSize> <fontFileName> <charsetFileName>\n");
-            fprintf(rgsFile, "#    p <controlId> <propertyId> <propertyValue>  Property description\n#\n");
+    printf("Batch conversion: %i files, %i worker(s)\n", files.count, jobs);
 
-            if (customFontLoaded)
-            {
-                fprintf(rgsFile, "# WARNING: This style uses a custom font, must be provided with style file\n#\n");
-                fprintf(rgsFile, "v %i\n", GUI_STYLE_RGS_VERSION);
+    int convertedCount = 0;
+    int failedCount = 0;
+    long long inputTotalSize = 0;
+    long long outputTotalSize = 0;
+    int countDigits = (int)strlen(TextFormat("%i", files.count));
 
-                // Save charset into an external file
-                // NOTE: Only saving charset if not basic one (95 codepoints)
-                // WARNING: codepointList and codepointListCount are global variables in gui_window_font_atlas module
-                if (codepointListCount > 95)
-                {
-                    char *textData = (char *)RL_CALLOC(1024*1024, 1);    // Allocate 1MB for text data
+    double startTime = GetTimeStamp();
 
-                    const char *value = NULL;
-                    int valueSize = 0;
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        if (collisions[i] < 0) continue;
 
-                    for (int i = 0, k = 0; i < codepointListCount; i++, k += valueSize)
-                    {
-                        value = CodepointToUTF8(codepointList[i], &valueSize);
+        failedCount++;
+        printf("[%*i/%i] FAILED  %s (output name already used by %s)\n", countDigits, failedCount, files.count, files.paths[i], files.paths[collisions[i]]);
+    }
 
-                        for (int c = 0; c < valueSize; c++) textData[k + c] = value[c];
-                    }
+    RL_FREE(collisions);
+    RL_FREE(namesHash);
 
-                    // Save charset data
-                    SaveFileText(TextFormat("%s/charset.txt", GetDirectoryPath(fileName)), textData);
+#if !defined(_WIN32)
+    int taskPipe[2] = { -1, -1 };       // Files indices to be converted: main process -> workers
+    int resultPipe[2] = { -1, -1 };     // Conversion results: workers -> main process
 
-                    RL_FREE(textData);
-                }
+    if ((jobs > 1) && (pipe(taskPipe) == 0) && (pipe(resultPipe) == 0))
+    {
+        fflush(stdout);     // Avoid duplicating buffered output on workers
+
+        int workersCount = 0;
+
+        for (int w = 0; w < jobs; w++)
+        {
+            pid_t pid = fork();
+
+            if (pid == 0)
+            {
+                // Worker process: convert files while indices are available
+                close(taskPipe[1]);
+                close(resultPipe[0]);
+
+                int index = 0;
 
-                if (FileExists(TextFormat("%s/charset.txt", GetDirectoryPath(fileName)))) // Check charset.txt saved successfully
+                while (read(taskPipe[0], &index, sizeof(int)) == sizeof(int))
                 {
-                    fprintf(rgsFile, "f %i %s %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), GetFileName(inFontFileName), "charset.txt");
+                    StyleBatchResult result = { 0 };
+                    char outFile[512] = { 0 };
+                    snprintf(outFile, 512, "%s/%s", outPath, GetFileNameWithoutExt(files.paths[index]));
+
+                    double time = GetTimeStamp();
+                    result.index = index;
+                    result.inputSize = GetFileLength(files.paths[index]);
+                    result.outputSize = ConvertStyleFile(files.paths[index], outFile, formatFlags);
+                    result.time = (float)(GetTimeStamp() - time);
+
+                    if (write(resultPipe[1], &result, sizeof(StyleBatchResult)) != sizeof(StyleBatchResult)) break;
                 }
-                else fprintf(rgsFile, "f %i %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), GetFileName(inFontFileName));
+
+                close(taskPipe[0]);
+                close(resultPipe[1]);
+
+                UnloadStyleHeadless();
+                if (IsWindowReady()) CloseWindow();
+                _exit(0);
             }
-            else fprintf(rgsFile, "#\nv %i\n", GUI_STYLE_RGS_VERSION);
+            else if (pid > 0) workersCount++;
+        }
 
-            // Save DEFAULT properties that changed
-            for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+        close(taskPipe[0]);
+        close(resultPipe[1]);
+
+        if (workersCount == 0) close(taskPipe[1]);
+        else
+        {
+            // Dispatch some files per worker in advance, next files dispatched as results are received
+            // NOTE: Keeping a limited number of files in flight avoids pipes filling and blocking both ends
+            int nextTask = 0;
+            int receivedCount = 0;
+
+            while ((nextTask < taskCount) && (nextTask < workersCount*2))
             {
-                if (defaultStyle[i] != GuiGetStyle(0, i))
-                {
-                    // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
-                    if (i < RAYGUI_MAX_PROPS_BASE) fprintf(rgsFile, "p 00 %02i 0x%08x    DEFAULT_%s \n", i, GuiGetStyle(0, i), guiProps[i].name);
-                    else  fprintf(rgsFile, "p 00 %02i 0x%08x    %s \n", i, GuiGetStyle(0, i), guiPropsDefaultExtended[i - RAYGUI_MAX_PROPS_BASE].name);
-                }
+                if (write(taskPipe[1], &tasks[nextTask], sizeof(int)) != sizeof(int)) break;
+                nextTask++;
             }
+            if (nextTask >= taskCount) close(taskPipe[1]);
 
-            // Save all properties that have changed in comparison to default style
-            for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+            StyleBatchResult result = { 0 };
+
+            while ((receivedCount < taskCount) && (read(resultPipe[0], &result, sizeof(StyleBatchResult)) == sizeof(StyleBatchResult)))
             {
-                for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
-                {
-                    // NOTE: Check Control property different than default (light) style
-                    if (GuiGetStyle(i, j) != defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j])
-                    {
-                        // Check property is different than its DEFAULT alternative ||
-                        // property different than default (light) style DEFAULT alternative
-                        if ((GuiGetStyle(i, j) != GuiGetStyle(0, j)) ||
-                            (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != defaultStyle[j]))
-                        {
-                            // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
-                            fprintf(rgsFile, "p %02i %02i 0x%08x    %s_%s \n", i, j, GuiGetStyle(i, j), guiControlText[i], (j < RAYGUI_MAX_PROPS_BASE)? guiProps[j].name : TextFormat("EXT%02i", (j - RAYGUI_MAX_PROPS_BASE)));
-                        }
-                    }
-                }
+                receivedCount++;
 
-                // NOTE: Extended properties are not shared beetween controls, they are unique, even DEFAULT ones
-                for (int j = RAYGUI_MAX_PROPS_BASE; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+                if (result.outputSize > 0) convertedCount++;
+                else failedCount++;
+                inputTotalSize += result.inputSize;
+                outputTotalSize += result.outputSize;
+
+                printf("[%*i/%i] %s  %s (%.2f ms)\n", countDigits, convertedCount + failedCount, files.count,
+                    (result.outputSize > 0)? "OK    " : "FAILED", files.paths[result.index], result.time*1000.0f);
+
+                if (nextTask < taskCount)
                 {
-                    if (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j))
-                    {
-                        fprintf(rgsFile, "    { %i, %i, (int)0x%08x },    // %s_%s\n", i, j, GuiGetStyle(i, j), guiControlText[i], TextFormat("EXTENDED%02i", j - RAYGUI_MAX_PROPS_BASE + 1));
-                    }
+                    if (write(taskPipe[1], &tasks[nextTask], sizeof(int)) == sizeof(int)) nextTask++;
+                    if (nextTask >= taskCount) close(taskPipe[1]);
                 }
             }
 
-            fclose(rgsFile);
-            result = 1;
+            if (nextTask < taskCount) close(taskPipe[1]);
+
+            // Files not reported by workers (i.e. worker crashed) are considered failed
+            failedCount += (taskCount - receivedCount);
+
+            for (int w = 0; w < workersCount; w++) wait(NULL);
+        }
+
+        close(resultPipe[0]);
+    }
+    else
+#endif
+    {
+        // Sequential conversion on main process
+        for (int t = 0; t < taskCount; t++)
+        {
+            int i = tasks[t];
+            char outFile[512] = { 0 };
+            snprintf(outFile, 512, "%s/%s", outPath, GetFileNameWithoutExt(files.paths[i]));
+
+            double time = GetTimeStamp();
+            int inputSize = GetFileLength(files.paths[i]);
+            int outputSize = ConvertStyleFile(files.paths[i], outFile, formatFlags);
+            time = GetTimeStamp() - time;
+            ProfileFileEnd(files.paths[i]);
+
+            if (outputSize > 0) convertedCount++;
+            else failedCount++;
+            inputTotalSize += inputSize;
+            outputTotalSize += outputSize;
+
+            printf("[%*i/%i] %s  %s (%.2f ms)\n", countDigits, convertedCount + failedCount, files.count,
+                (outputSize > 0)? "OK    " : "FAILED", files.paths[i], time*1000.0);
         }
     }
 
-    return result;
+    RL_FREE(tasks);
+
+    double totalTime = GetTimeStamp() - startTime;
+    if (totalTime <= 0.0) totalTime = 0.000001;
+
+    // Batch throughput summary
+    printf("\nConverted %i/%i files (%i failed) in %.3f s using %i worker(s)\n", convertedCount, files.count, failedCount, totalTime, jobs);
+    printf("Throughput: %.1f files/s, input %.2f MB/s, output %.2f MB/s\n", files.count/totalTime,
+        (inputTotalSize/(1024.0*1024.0))/totalTime, (outputTotalSize/(1024.0*1024.0))/totalTime);
+
+    return convertedCount;
 }
 
-// Export gui style as properties array
-// NOTE: Code file already implements a function to load style
-// GLOBAL: guiStyle, inFontFileName
-static void ExportStyleAsCode(const char *fileName, const char *styleName)
+// Export style template (loaded from embedded code) to output directory
+// NOTE: Template files are exported as required by raygui styles repository: <outPath>/<name>/style_<name>.<ext>,
+// font file used is also copied, template font data is kept CPU-side, a hidden window is only created for table image
+static int ExportStyleTemplate(int index, const char *outPath, int formatFlags)
 {
-    // DEFAULT extended properties
-    static const char *guiPropsExtText[RAYGUI_MAX_PROPS_EXTENDED] = {
-        "TEXT_SIZE",
-        "TEXT_SPACING",
-        "LINE_COLOR",
-        "BACKGROUND_COLOR",
-        "TEXT_LINE_SPACING",
-        "TEXT_ALIGNMENT_VERTICAL",
-        "TEXT_WRAP_MODE",
-        "EXTENDED08",
-    };
-
-    FILE *txtFile = fopen(fileName, "wt");
+    if ((index < 0) || (index >= MAX_GUI_STYLES_AVAILABLE)) return 0;
 
-    if (txtFile != NULL)
-    {
-        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// StyleAsCode exporter v2.0 - Style data exported as a values array            //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// USAGE: On init call: GuiLoadStyle%s();                                   //\n", TextToPascal(styleName));
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
-        fprintf(txtFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// Copyright (c) 2020-2026 raylib technologies (@raylibtech)                    //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+    int outputSize = 0;
+    char styleNameLower[64] = { 0 };
+    char styleDirPath[256] = { 0 };
 
-        char styleNameLower[64] = { 0 };
-        strcpy(styleNameLower, TextToLower(styleName));
+    snprintf(styleNameLower, 64, "%s", TextToLower(styleNames[index]));
+    snprintf(styleDirPath, 256, "%s/%s", outPath, styleNameLower);
+    if (!DirectoryExists(styleDirPath)) MakeDirectory(styleDirPath);
 
-        // Export only properties that change from default style
-        // TODO: WARNING: This count is wrong!
-        fprintf(txtFile, "#define %s_STYLE_PROPS_COUNT  %i\n\n", TextToUpper(styleName), CountStyleChangesDefault());
+    LoadStyleTemplateExport(index);
 
-        // Write byte data as hexadecimal text
-        fprintf(txtFile, "// Custom style name: %s\n", styleName);
-        fprintf(txtFile, "static const GuiStyleProp %sStyleProps[%s_STYLE_PROPS_COUNT] = {\n", styleNameLower, TextToUpper(styleName));
+    for (int format = STYLE_BINARY; format <= STYLE_TEXT; format++)
+    {
+        if ((formatFlags & (1 << format)) == 0) continue;
 
-        // Write all properties that have changed in default (light) style
-        for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
-        {
-            if (defaultStyle[i] != GuiGetStyle(0, i))
-            {
-                if (i < RAYGUI_MAX_PROPS_BASE) fprintf(txtFile, "    { 0, %i, (int)0x%08x },    // DEFAULT_%s\n", i, GuiGetStyle(DEFAULT, i), guiProps[i].name);
-                else fprintf(txtFile, "    { 0, %i, (int)0x%08x },    // DEFAULT_%s \n", i, GuiGetStyle(DEFAULT, i), guiPropsExtText[i - RAYGUI_MAX_PROPS_BASE]);
-            }
-        }
+        char outFilePath[512] = { 0 };      // NOTE: TextFormat() static buffers are reused by exporters
+        snprintf(outFilePath, 512, "%s/style_%s%s", styleDirPath, styleNameLower, GetStyleFileExtension(format));
 
-        // Write all properties that have changed in comparison to default style
-        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+        switch (format)
         {
-            for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+            case STYLE_AS_CODE: ExportStyleAsCode(outFilePath, styleNames[index]); break;
+            case STYLE_TABLE_IMAGE:
             {
-                // NOTE: Check Control property different than default (light) style
-                if (GuiGetStyle(i, j) != defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j])
-                {
-                    // Check property is different than its DEFAULT alternative ||
-                    // property different than default (light) style DEFAULT alternative
-                    if ((GuiGetStyle(i, j) != GuiGetStyle(0, j)) ||
-                        (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != defaultStyle[j]))
-                    {
-                        fprintf(txtFile, "    { %i, %i, (int)0x%08x },    // %s_%s\n", i, j, GuiGetStyle(i, j), guiControlText[i], guiProps[j].name);
-                    }
-                }
-            }
+                Image imStyleTable = GenImageStyleTableExport(styleNames[index]);
+                ExportImage(imStyleTable, outFilePath);
+                UnloadImage(imStyleTable);
 
-            // NOTE: Extended properties are not shared beetween controls, they are unique, even DEFAULT ones
-            for (int j = RAYGUI_MAX_PROPS_BASE; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
-            {
-                if (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j))
-                {
-                    fprintf(txtFile, "    { %i, %i, (int)0x%08x },    // %s_%s\n", i, j, GuiGetStyle(i, j), guiControlText[i], TextFormat("EXTENDED%02i", j - RAYGUI_MAX_PROPS_BASE + 1));
-                }
-            }
+                // Write a custom chunk - rGSf (rGuiStyler file)
+                rpng_chunk chunk = { 0 };
+                memcpy(chunk.type, "rGSf", 4);      // Chunk type FOURCC
+                chunk.data = SaveStyleToMemory(&chunk.length);
+                rpng_chunk_write(outFilePath, chunk);
+                RPNG_FREE(chunk.data);
+            } break;
+            default: SaveStyle(outFilePath, format); break;
         }
 
-        fprintf(txtFile, "};\n\n");
+        if (!FileExists(outFilePath)) return 0;
 
-        if (customFontLoaded)
-        {
-            // NOTE: Font name is also updated in guiFontName on style loading
-            fprintf(txtFile, "// WARNING: This style uses a custom font: \"%s\" (size: %i, spacing: %i)\n\n",
-                    GetFileName(inFontFileName), GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
-        }
+        outputSize += GetFileLength(outFilePath);
+    }
 
-        Image imFont = { 0 };
+    // Copy font file used (.ttf/.otf), referenced by text style
+    // NOTE: Font files paths are relative to working directory, Light style uses default font (no file)
+    if ((defaultStyleFont[index] > 0) && FileExists(inFontFileName))
+    {
+        char fontFilePath[512] = { 0 };
+        snprintf(fontFilePath, 512, "%s/%s", styleDirPath, GetFileName(inFontFileName));
+        FileCopy(inFontFileName, fontFilePath);
+    }
+    else if (defaultStyleFont[index] > 0) printf("WARNING: Font file not found: %s\n", inFontFileName);
+
+    return outputSize;
+}
+
+// Load style template with font data set up for exporters
+// NOTE: Same data as loading style file on command line (LoadStyleHeadless()), template font atlas
+// and font data are captured CPU-side on template loading, no window or GPU required
+// WARNING: Light template uses raygui default font, no custom font is set up
+static void LoadStyleTemplateExport(int index)
+{
+    UnloadStyleHeadless();
+
+    styleTemplateHeadless = true;
+    LoadStyleTemplate(index);
+    styleTemplateHeadless = false;
+
+    customFontLoaded = (customFontAtlas.data != NULL) && (customFont.glyphCount > 0);
+    snprintf(currentStyleName, 32, "%s", styleNames[index]);
+
+    if (customFontLoaded)
+    {
+        snprintf(inFontFileName, 512, "%s", fontFilePaths[defaultStyleFont[index]]);
+
+        // Font codepoints required for text style charset export
+        // WARNING: codepointList and codepointListCount are global variables in gui_window_font_atlas module
+        codepointList = (int *)RL_CALLOC(customFont.glyphCount, sizeof(int));
+        codepointListCount = customFont.glyphCount;
+        for (int i = 0; i < customFont.glyphCount; i++) codepointList[i] = customFont.glyphs[i].value;
+    }
+}
+
+// Generate controls table image for loaded style (command line)
+// NOTE: Table image generation requires GPU rendering, a hidden window (and OpenGL context)
+// is only created for this format, custom font atlas is uploaded to draw the table with style font
+static Image GenImageStyleTableExport(const char *styleName)
+{
+    ProfileStageBegin(PROFILE_TEXTURE_CREATE);
+    if (!IsWindowReady())
+    {
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+        InitWindow(1920, 256, toolName);
+    }
+
+    Font font = customFont;
+    if (customFontLoaded)
+    {
+        font.texture = LoadTextureFromImage(customFontAtlas);
+        GuiSetFont(font);
+        if ((fontWhiteRec.width > 0) && (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
+    }
+    ProfileStageEnd(PROFILE_TEXTURE_CREATE, customFontLoaded? GetPixelDataSize(customFontAtlas.width, customFontAtlas.height, customFontAtlas.format) : 0);
+
+    ProfileStageBegin(PROFILE_TABLE_RENDER);
+    Image imStyleTable = GenImageStyleControlsTable(1920, 256, styleName);
+    ProfileStageEnd(PROFILE_TABLE_RENDER, GetPixelDataSize(imStyleTable.width, imStyleTable.height, imStyleTable.format));
+
+    if (font.texture.id > 0)
+    {
+        // Restore default font, custom font data is still owned by customFont
+        GuiSetFont(GetFontDefault());
+        SetShapesTexture((Texture2D){ 0 }, (Rectangle){ 0 });
+        UnloadTexture(font.texture);
+    }
+
+    return imStyleTable;
+}
+
+// Save styles bundle file (.rgsb)
+// NOTE: Every style is saved as binary style and split into properties data (PROP/PRPC sections)
+// and font data (FONT, ATLS, RECS, GLYP... sections), both saved as valid style files (.rgs v700),
+// font data is deduplicated by content hash so styles sharing a font store its atlas only once,
+// style templates are bundled if no input files provided (hidden window required)
+static int SaveStyleBundle(const char *fileName, FilePathList files)
+{
+    int styleCount = (files.count > 0)? (int)files.count : MAX_GUI_STYLES_AVAILABLE;
+
+    char (*styleNamesList)[32] = (char (*)[32])RL_CALLOC(styleCount, 32);
+    unsigned char **stylesData = (unsigned char **)RL_CALLOC(styleCount, sizeof(unsigned char *));
+    int *stylesDataSize = (int *)RL_CALLOC(styleCount, sizeof(int));
+    int *stylesFontIndex = (int *)RL_CALLOC(styleCount, sizeof(int));
+
+    unsigned char **fontsData = (unsigned char **)RL_CALLOC(styleCount, sizeof(unsigned char *));
+    int *fontsDataSize = (int *)RL_CALLOC(styleCount, sizeof(int));
+    unsigned long long *fontsHash = (unsigned long long *)RL_CALLOC(styleCount, sizeof(unsigned long long));
+    int fontCount = 0;
+    int fontRefCount = 0;       // Styles with custom font, including shared ones
+
+    bool success = true;
+
+    // NOTE: Bundled styles are split by sections, always saved as v700 styles (--rgs-version ignored)
+    int rgsVersion = styleRgsVersion;
+    styleRgsVersion = 700;
+
+    for (int i = 0; i < styleCount; i++)
+    {
+        if (files.count > 0)
+        {
+            if (!FileExists(files.paths[i]) || !LoadStyleHeadless(files.paths[i]))
+            {
+                printf("WARNING: Styles bundle input file not valid: %s\n", files.paths[i]);
+                success = false;
+                break;
+            }
+
+            // NOTE: Bundle style names are limited to 31 characters, styles are accessed by name,
+            // so names must be unique after truncation
+            const char *styleName = GetFileNameWithoutExt(files.paths[i]);
+            if (strlen(styleName) > 31) printf("WARNING: Styles bundle style name truncated to 31 characters: %s\n", styleName);
+            snprintf(styleNamesList[i], 32, "%s", styleName);
+
+            for (int n = 0; n < i; n++)
+            {
+                if (TextIsEqual(styleNamesList[n], styleNamesList[i]))
+                {
+                    printf("WARNING: Styles bundle style name [%s] already used: %s, %s\n", styleNamesList[i], files.paths[n], files.paths[i]);
+                    success = false;
+                    break;
+                }
+            }
+
+            if (!success) break;
+        }
+        else
+        {
+            LoadStyleTemplateExport(i);
+            snprintf(styleNamesList[i], 32, "%s", TextToLower(styleNames[i]));
+        }
+
+        int styleDataSize = 0;
+        unsigned char *styleData = (unsigned char *)SaveStyleToMemory(&styleDataSize);
+
+        // Split style sections: properties sections on style data, other sections on font data
+        // NOTE: Content hash section is computed again on saving
+        int sectionCount = 0;
+        memcpy(&sectionCount, styleData + 8, sizeof(int));
+
+        GuiStyleSection *propsSections = (GuiStyleSection *)RL_CALLOC(sectionCount, sizeof(GuiStyleSection));
+        GuiStyleSection *fontSections = (GuiStyleSection *)RL_CALLOC(sectionCount, sizeof(GuiStyleSection));
+        int propsSectionCount = 0;
+        int fontSectionCount = 0;
+
+        for (int s = 0; s < sectionCount; s++)
+        {
+            char id[5] = { 0 };
+            memcpy(id, styleData + 12 + s*20, 4);
+
+            if (strcmp(id, "HASH") == 0) continue;
+
+            GuiStyleSection section = GuiGetStyleSection(styleData, styleDataSize, id);
+            if (section.data == NULL) continue;
+
+            if ((strcmp(id, "PROP") == 0) || (strcmp(id, "PRPC") == 0)) propsSections[propsSectionCount++] = section;
+            else fontSections[fontSectionCount++] = section;
+        }
+
+        stylesData[i] = (unsigned char *)SaveStyleSectionsToMemory(propsSections, propsSectionCount, &stylesDataSize[i]);
+        stylesFontIndex[i] = -1;
+
+        if (fontSectionCount > 0)
+        {
+            int fontDataSize = 0;
+            unsigned char *fontData = (unsigned char *)SaveStyleSectionsToMemory(fontSections, fontSectionCount, &fontDataSize);
+            unsigned long long fontHash = GuiGetStyleHash(fontData, fontDataSize);
+
+            // Font data deduplicated, data compared in case of hash collision
+            for (int f = 0; f < fontCount; f++)
+            {
+                if ((fontsHash[f] == fontHash) && (fontsDataSize[f] == fontDataSize) &&
+                    (memcmp(fontsData[f], fontData, fontDataSize) == 0))
+                {
+                    stylesFontIndex[i] = f;
+                    break;
+                }
+            }
+
+            if (stylesFontIndex[i] < 0)
+            {
+                fontsData[fontCount] = fontData;
+                fontsDataSize[fontCount] = fontDataSize;
+                fontsHash[fontCount] = fontHash;
+                stylesFontIndex[i] = fontCount;
+                fontCount++;
+            }
+            else RL_FREE(fontData);
+
+            fontRefCount++;
+        }
+
+        RL_FREE(propsSections);
+        RL_FREE(fontSections);
+        RL_FREE(styleData);
+    }
+
+    int outputSize = 0;
+
+    if (success)
+    {
+        // Style Bundle File Structure (.rgsb)
+        // NOTE: Header, styles directory (48 bytes per style), fonts directory (8 bytes per font),
+        // styles data and fonts data, see raygui GuiLoadStyleBundleFromMemory() for details
+        int offset = 16 + styleCount*48 + fontCount*8;
+        int dataSize = offset;
+        for (int i = 0; i < styleCount; i++) dataSize += stylesDataSize[i];
+        for (int f = 0; f < fontCount; f++) dataSize += fontsDataSize[f];
+
+        unsigned char *buffer = (unsigned char *)RL_CALLOC(dataSize, 1);
+        short version = 700;
+
+        memcpy(buffer, "rGSB", 4);
+        memcpy(buffer + 4, &version, sizeof(short));
+        memcpy(buffer + 8, &styleCount, sizeof(int));
+        memcpy(buffer + 12, &fontCount, sizeof(int));
+
+        for (int i = 0; i < styleCount; i++)
+        {
+            unsigned char *entry = buffer + 16 + i*48;
+
+            memcpy(entry, styleNamesList[i], 31);
+            memcpy(entry + 32, &offset, sizeof(int));
+            memcpy(entry + 36, &stylesDataSize[i], sizeof(int));
+            memcpy(entry + 40, &stylesFontIndex[i], sizeof(int));
+            memcpy(buffer + offset, stylesData[i], stylesDataSize[i]);
+            offset += stylesDataSize[i];
+        }
+
+        for (int f = 0; f < fontCount; f++)
+        {
+            unsigned char *entry = buffer + 16 + styleCount*48 + f*8;
+
+            memcpy(entry, &offset, sizeof(int));
+            memcpy(entry + 4, &fontsDataSize[f], sizeof(int));
+            memcpy(buffer + offset, fontsData[f], fontsDataSize[f]);
+            offset += fontsDataSize[f];
+        }
+
+        if (SaveFileData(fileName, buffer, dataSize))
+        {
+            outputSize = dataSize;
+            printf("Styles bundle saved: %s (%i styles, %i/%i fonts stored, %.2f KB)\n", fileName, styleCount, fontCount, fontRefCount, dataSize/1024.0f);
+        }
+
+        RL_FREE(buffer);
+    }
+
+    styleRgsVersion = rgsVersion;
+
+    for (int i = 0; i < styleCount; i++) RL_FREE(stylesData[i]);
+    for (int f = 0; f < fontCount; f++) RL_FREE(fontsData[f]);
+    RL_FREE(styleNamesList);
+    RL_FREE(stylesData);
+    RL_FREE(stylesDataSize);
+    RL_FREE(stylesFontIndex);
+    RL_FREE(fontsData);
+    RL_FREE(fontsDataSize);
+    RL_FREE(fontsHash);
+
+    return outputSize;
+}
+
+// Export all style templates using a worker pool
+// NOTE: Templates font data is loaded CPU-side, worker processes only create a hidden window (OpenGL context)
+// if table image is requested, templates are distributed in advance (same amount of work per template), main process collects results,
+// returns exported templates count
+static int ExportStyleTemplatesBatch(const char *outPath, int formatFlags, int jobs)
+{
+    // Set a default output directory in case not provided
+    if (outPath[0] == '\0') outPath = "output";
+    if (!DirectoryExists(outPath)) MakeDirectory(outPath);
+
+    if (jobs <= 0)
+    {
+#if !defined(_WIN32)
+        jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        if (jobs <= 0) jobs = 1;
+    }
+    if (jobs > MAX_GUI_STYLES_AVAILABLE) jobs = MAX_GUI_STYLES_AVAILABLE;
+
+    printf("Templates export: %i styles, %i worker(s)\n", MAX_GUI_STYLES_AVAILABLE, jobs);
+
+    int exportedCount = 0;
+    long long outputTotalSize = 0;
+
+    double startTime = GetTimeStamp();
+
+#if !defined(_WIN32)
+    int resultPipe[2] = { -1, -1 };     // Export results: workers -> main process
+
+    if ((jobs > 1) && (pipe(resultPipe) == 0))
+    {
+        fflush(stdout);     // Avoid duplicating buffered output on workers
+
+        int workersCount = 0;
+
+        for (int w = 0; w < jobs; w++)
+        {
+            pid_t pid = fork();
+
+            if (pid == 0)
+            {
+                // Worker process: export templates w, w + jobs, w + 2*jobs...
+                close(resultPipe[0]);
+
+                for (int index = w; index < MAX_GUI_STYLES_AVAILABLE; index += jobs)
+                {
+                    StyleBatchResult result = { 0 };
+
+                    double time = GetTimeStamp();
+                    result.index = index;
+                    result.outputSize = ExportStyleTemplate(index, outPath, formatFlags);
+                    result.time = (float)(GetTimeStamp() - time);
+
+                    if (write(resultPipe[1], &result, sizeof(StyleBatchResult)) != sizeof(StyleBatchResult)) break;
+                }
+
+                close(resultPipe[1]);
+
+                UnloadStyleHeadless();
+                if (IsWindowReady()) CloseWindow();
+                _exit(0);
+            }
+            else if (pid > 0) workersCount++;
+            else break;
+        }
+
+        close(resultPipe[1]);
+
+        int receivedCount = 0;
+        bool received[MAX_GUI_STYLES_AVAILABLE] = { 0 };
+        StyleBatchResult result = { 0 };
+
+        while ((receivedCount < MAX_GUI_STYLES_AVAILABLE) && (read(resultPipe[0], &result, sizeof(StyleBatchResult)) == sizeof(StyleBatchResult)))
+        {
+            receivedCount++;
+            if ((result.index >= 0) && (result.index < MAX_GUI_STYLES_AVAILABLE)) received[result.index] = true;
+
+            if (result.outputSize > 0) exportedCount++;
+            outputTotalSize += result.outputSize;
+
+            printf("[%2i/%i] %s  %s (%.2f ms)\n", receivedCount, MAX_GUI_STYLES_AVAILABLE,
+                (result.outputSize > 0)? "OK    " : "FAILED", styleNames[result.index], result.time*1000.0f);
+        }
+
+        for (int w = 0; w < workersCount; w++) wait(NULL);
+
+        close(resultPipe[0]);
+
+        // NOTE: Templates assigned to workers not created (fork failed) or workers crashed are not exported
+        for (int i = 0; i < MAX_GUI_STYLES_AVAILABLE; i++)
+        {
+            if (received[i]) continue;
+
+            receivedCount++;
+            printf("[%2i/%i] FAILED  %s (not exported)\n", receivedCount, MAX_GUI_STYLES_AVAILABLE, styleNames[i]);
+        }
+    }
+    else
+#endif
+    {
+        // Sequential export on main process
+        for (int i = 0; i < MAX_GUI_STYLES_AVAILABLE; i++)
+        {
+            double time = GetTimeStamp();
+            int outputSize = ExportStyleTemplate(i, outPath, formatFlags);
+            time = GetTimeStamp() - time;
+            ProfileFileEnd(styleNames[i]);
+
+            if (outputSize > 0) exportedCount++;
+            outputTotalSize += outputSize;
+
+            printf("[%2i/%i] %s  %s (%.2f ms)\n", i + 1, MAX_GUI_STYLES_AVAILABLE,
+                (outputSize > 0)? "OK    " : "FAILED", styleNames[i], time*1000.0);
+        }
+    }
+
+    double totalTime = GetTimeStamp() - startTime;
+    if (totalTime <= 0.0) totalTime = 0.000001;
+
+    printf("\nExported %i/%i style templates to %s in %.3f s using %i worker(s), output %.2f KB\n",
+        exportedCount, MAX_GUI_STYLES_AVAILABLE, outPath, totalTime, jobs, outputTotalSize/1024.0);
+
+    return exportedCount;
+}
+
+// Serve conversion requests from stdin, one JSON object per line, one JSON result line per request
+// Request:  { "id": 1, "input": "style.rgs", "rgs": "out.rgs", "txt": "out.rgs.txt", "h": "out.h", "png": "out.png" }
+// Result:   { "id": 1, "ok": true, "cached": false, "outputs": [ { "file": "out.h", "size": 1234 } ], "time_ms": 0.250 }
+// NOTE: Process stays resident, default style, last loaded style (and font) and hidden window
+// (only created for table image) are reused between requests, { "cmd": "quit" } or EOF exits
+// NOTE: Last loaded style is reused if content hash did not change (style file and referenced font and charset files)
+// NOTE: Outputs to stdout ("-") are rejected, stdout is reserved for results
+static void ServeStyleRequests(void)
+{
+    #define MAX_SERVE_REQUEST_SIZE  4096
+
+    static const char *outputKeys[4] = { "rgs", "txt", "h", "png" };
+    static const int outputFormats[4] = { STYLE_BINARY, STYLE_TEXT, STYLE_AS_CODE, STYLE_TABLE_IMAGE };
+
+    char request[MAX_SERVE_REQUEST_SIZE] = { 0 };
+    char loadedFileName[512] = { 0 };   // Last loaded style file, kept decoded for next requests
+    unsigned long long loadedFileHash = 0; // Last loaded style content hash
+
+    // WARNING: stdout is used for results, make sure nothing else is logged
+    SetTraceLogLevel(LOG_NONE);
+
+    while (fgets(request, MAX_SERVE_REQUEST_SIZE, stdin) != NULL)
+    {
+        char id[64] = { 0 };
+        char value[512] = { 0 };
+        bool requestTooLong = (strchr(request, '\n') == NULL) && !feof(stdin);
+
+        if (requestTooLong)
+        {
+            // Skip remaining request line
+            int c = 0;
+            while (((c = fgetc(stdin)) != EOF) && (c != '\n')) { }
+        }
+
+        // Skip empty lines
+        char *text = request;
+        while ((*text == ' ') || (*text == '\t') || (*text == '\r') || (*text == '\n')) text++;
+        if (*text == '\0') continue;
+
+        // NOTE: Request id is returned as provided (number or string)
+        int idType = GetJsonValue(text, "id", id, 64);
+        if (idType == 0) strcpy(id, "null");
+
+        if ((GetJsonValue(text, "cmd", value, 512) != 0) && (strcmp(value, "quit") == 0))
+        {
+            printf("{ \"id\": ");
+            if (idType == 1) PrintJsonString(id);
+            else printf("%s", id);
+            printf(", \"ok\": true }\n");
+            fflush(stdout);
+            break;
+        }
+
+        double time = GetTimeStamp();
+        const char *error = NULL;
+        bool cached = false;
+
+        if (requestTooLong) error = "request too long";
+        else if (GetJsonValue(text, "input", value, 512) == 0) error = "input not provided";
+        else if (!FileExists(value)) error = "input file not found";
+        else
+        {
+            // Reuse last loaded style if input file content has not changed
+            // NOTE: Modification time is not reliable, files could be rewritten within the same second
+            StyleWatchEntry entry = { 0 };
+            snprintf(entry.fileName, 512, "%s", value);
+            unsigned long long hash = ComputeStyleWatchHash(&entry);
+            cached = (strcmp(value, loadedFileName) == 0) && (hash != 0) && (hash == loadedFileHash);
+
+            if (!cached)
+            {
+                if (LoadStyleHeadless(value))
+                {
+                    // Loaded style backup, exporters could modify some properties (table image)
+                    memcpy(loadedStyle, guiStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+                    strcpy(loadedFileName, value);
+                    loadedFileHash = hash;
+                }
+                else
+                {
+                    // NOTE: Invalid style is not kept as last loaded style
+                    memset(loadedFileName, 0, 512);
+                    error = "input style not valid";
+                }
+            }
+        }
+
+        // Check requested outputs before exporting any of them
+        // WARNING: stdout is used for results, outputs can not be written to it
+        for (int i = 0; (error == NULL) && (i < 4); i++)
+        {
+            if (GetJsonValue(text, outputKeys[i], value, 512) != 0)
+            {
+                bool outputStdout = (strcmp(value, "-") == 0) || (strcmp(value, "/dev/stdout") == 0) ||
+                    (strcmp(value, "/dev/fd/1") == 0) || (strcmp(value, "/proc/self/fd/1") == 0);
+#if defined(PLATFORM_DESKTOP) && !defined(_WIN32)
+                // NOTE: Existing paths are compared with stdout file (links, named pipes...)
+                struct stat outStat = { 0 };
+                struct stat stdoutStat = { 0 };
+                if ((stat(value, &outStat) == 0) && (fstat(fileno(stdout), &stdoutStat) == 0) &&
+                    (outStat.st_dev == stdoutStat.st_dev) && (outStat.st_ino == stdoutStat.st_ino)) outputStdout = true;
+#elif defined(_WIN32)
+                if (TextIsEqual(TextToLower(value), "con") || TextIsEqual(TextToLower(value), "conout$")) outputStdout = true;
+#endif
+                if (outputStdout) error = "output to stdout not supported";
+            }
+        }
+
+        // Export requested outputs
+        char outputFiles[4][512] = { 0 };
+        int outputSizes[4] = { 0 };
+        int outputCount = 0;
+
+        for (int i = 0; (error == NULL) && (i < 4); i++)
+        {
+            if (GetJsonValue(text, outputKeys[i], outputFiles[outputCount], 512) != 0)
+            {
+                memcpy(guiStyle, loadedStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+
+                outputSizes[outputCount] = ExportStyleFile(outputFiles[outputCount], outputFormats[i]);
+                if (outputSizes[outputCount] == 0) error = "export failed";
+                outputCount++;
+            }
+        }
+
+        if ((error == NULL) && (outputCount == 0)) error = "no output provided";
+
+        time = GetTimeStamp() - time;
+
+        // Write request result
+        printf("{ \"id\": ");
+        if (idType == 1) PrintJsonString(id);
+        else printf("%s", id);
+        printf(", \"ok\": %s, ", (error == NULL)? "true" : "false");
+        if (error != NULL) printf("\"error\": \"%s\", ", error);
+        printf("\"cached\": %s, \"outputs\": [", cached? "true" : "false");
+        for (int i = 0; i < outputCount; i++)
+        {
+            printf("%s{ \"file\": ", (i > 0)? ", " : " ");
+            PrintJsonString(outputFiles[i]);
+            printf(", \"size\": %i }%s", outputSizes[i], (i == (outputCount - 1))? " " : "");
+        }
+        printf("], \"time_ms\": %.3f }\n", time*1000.0);
+        fflush(stdout);
+    }
+}
+
+// Watch directory style files and re-export changed ones
+// NOTE: Linux uses inotify, other platforms fallback to files modification time polling,
+// changes are debounced (editors could write multiple times per save) and styles are only
+// rebuilt if content hash changed, runs until process is terminated (Ctrl+C)
+static void WatchStyleFiles(const char *dirPath, const char *outPath, int formatFlags)
+{
+    #define WATCH_DEBOUNCE_TIME_MS      200     // Time without changes required to start rebuild
+    #define WATCH_POLLING_TIME_MS       500     // Files modification time polling interval (no inotify)
+    #define WATCH_MAX_DIRECTORIES        64     // Maximum directories watched: styles and referenced files directories
+
+    StyleWatchEntry *entries = NULL;
+    int entryCount = 0;
+
+    if ((outPath == NULL) || (outPath[0] == '\0')) outPath = "output";
+    if (!DirectoryExists(outPath)) MakeDirectory(outPath);
+
+    // Initial directory scan, styles are built if output is missing or older than inputs
+    FilePathList files = LoadDirectoryFilesEx(dirPath, ".rgs", false);
+    entries = (StyleWatchEntry *)RL_CALLOC((files.count > 0)? files.count : 1, sizeof(StyleWatchEntry));
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        snprintf(entries[i].fileName, 512, "%s", files.paths[i]);
+        entries[i].dirty = true;
+    }
+    entryCount = files.count;
+    UnloadDirectoryFiles(files);
+
+    bool initialBuild = true;
+
+#if defined(__linux__)
+    // NOTE: Referenced font and charset files could be out of styles directory,
+    // their directories are also watched once styles referencing them are loaded
+    int watchDirIds[WATCH_MAX_DIRECTORIES] = { 0 };
+    char watchDirPaths[WATCH_MAX_DIRECTORIES][512] = { 0 };
+    int watchDirCount = 0;
+
+    int watchFd = inotify_init();
+    if ((watchFd < 0) || ((watchDirIds[0] = inotify_add_watch(watchFd, dirPath, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE)) < 0))
+    {
+        printf("WARNING: Directory can not be watched: %s\n", dirPath);
+        RL_FREE(entries);
+        return;
+    }
+
+    snprintf(watchDirPaths[0], 512, "%s", dirPath);
+    watchDirCount = 1;
+#endif
+
+    printf("Watching %i style(s) on %s, output: %s (Ctrl+C to exit)\n", entryCount, dirPath, outPath);
+    fflush(stdout);
+
+    while (true)
+    {
+        // Rebuild dirty styles with changed content
+        for (int i = 0; i < entryCount; i++)
+        {
+            if (!entries[i].dirty) continue;
+            entries[i].dirty = false;
+
+            unsigned long long hash = ComputeStyleWatchHash(&entries[i]);
+            if ((hash == 0) || (hash == entries[i].hash)) continue;
+            entries[i].hash = hash;
+
+            char outFile[512] = { 0 };
+            snprintf(outFile, 512, "%s/%s", outPath, GetFileNameWithoutExt(entries[i].fileName));
+
+            if (initialBuild)
+            {
+                // Skip initial rebuild if all outputs are up to date
+                bool upToDate = true;
+                for (int format = STYLE_BINARY; format <= STYLE_TEXT; format++)
+                {
+                    if ((formatFlags & (1 << format)) == 0) continue;
+
+                    const char *outFilePath = TextFormat("%s%s", outFile, GetStyleFileExtension(format));
+                    if (!FileExists(outFilePath) || (GetFileModTime(outFilePath) < entries[i].modTime)) upToDate = false;
+                }
+
+                if (upToDate) continue;
+            }
+
+            double buildTime = GetTimeStamp();
+            int outputSize = ConvertStyleFile(entries[i].fileName, outFile, formatFlags);
+            buildTime = GetTimeStamp() - buildTime;
+
+            char timeText[16] = { 0 };
+            time_t now = time(NULL);
+            strftime(timeText, 16, "%H:%M:%S", localtime(&now));
+
+            printf("[%s] %s  %s (%.2f ms)\n", timeText, (outputSize > 0)? "REBUILT" : "FAILED ", entries[i].fileName, buildTime*1000.0);
+            fflush(stdout);
+        }
+
+        initialBuild = false;
+
+#if defined(__linux__)
+        // Watch referenced files directories not watched yet
+        for (int i = 0; i < entryCount; i++)
+        {
+            const char *refFileNames[2] = { entries[i].fontFileName, entries[i].charsetFileName };
+
+            for (int r = 0; r < 2; r++)
+            {
+                if (refFileNames[r][0] == '\0') continue;
+
+                const char *refDirPath = GetDirectoryPath(refFileNames[r]);
+                bool watched = false;
+                for (int d = 0; d < watchDirCount; d++) if (strcmp(watchDirPaths[d], refDirPath) == 0) { watched = true; break; }
+
+                if (!watched && (watchDirCount < WATCH_MAX_DIRECTORIES))
+                {
+                    // NOTE: Same directory referenced with a different path returns the same watch id
+                    int watchDirId = inotify_add_watch(watchFd, refDirPath, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+                    if (watchDirId >= 0)
+                    {
+                        watchDirIds[watchDirCount] = watchDirId;
+                        snprintf(watchDirPaths[watchDirCount], 512, "%s", refDirPath);
+                        watchDirCount++;
+                    }
+                    else printf("WARNING: Directory can not be watched: %s\n", refDirPath);
+                }
+            }
+        }
+#endif
+
+        // Wait for changes
+        bool changesDetected = false;
+
+        while (!changesDetected)
+        {
+#if defined(__linux__)
+            char events[4096] __attribute__ ((aligned(__alignof__(struct inotify_event)))) = { 0 };
+            struct pollfd pfd = { watchFd, POLLIN, 0 };
+
+            // NOTE: Debounce, keep reading events until no more changes received for some time
+            int timeout = -1;
+            while (poll(&pfd, 1, timeout) > 0)
+            {
+                int length = (int)read(watchFd, events, sizeof(events));
+                if (length <= 0) break;
+
+                for (int offset = 0; offset < length; )
+                {
+                    struct inotify_event *event = (struct inotify_event *)(events + offset);
+                    offset += (int)sizeof(struct inotify_event) + event->len;
+
+                    if ((event->len == 0) || (event->mask & IN_ISDIR)) continue;
+
+                    if ((event->wd == watchDirIds[0]) && IsFileExtension(event->name, ".rgs"))
+                    {
+                        char fileName[512] = { 0 };
+                        snprintf(fileName, 512, "%s/%s", dirPath, event->name);
+
+                        int index = -1;
+                        for (int i = 0; i < entryCount; i++) if (strcmp(GetFileName(entries[i].fileName), event->name) == 0) { index = i; break; }
+
+                        if (index < 0)
+                        {
+                            // New style file added to watch list
+                            entries = (StyleWatchEntry *)RL_REALLOC(entries, (entryCount + 1)*sizeof(StyleWatchEntry));
+                            memset(&entries[entryCount], 0, sizeof(StyleWatchEntry));
+                            strcpy(entries[entryCount].fileName, fileName);
+                            index = entryCount;
+                            entryCount++;
+                        }
+
+                        entries[index].dirty = true;
+                        changesDetected = true;
+                    }
+                    else if (IsFileExtension(event->name, ".ttf;.otf;.txt"))
+                    {
+                        // Referenced font or charset changed, mark styles using it
+                        // NOTE: File path checked for every directory path watched with event watch id
+                        for (int d = 0; d < watchDirCount; d++)
+                        {
+                            if (watchDirIds[d] != event->wd) continue;
+
+                            char fileName[1024] = { 0 };
+                            snprintf(fileName, 1024, "%s/%s", watchDirPaths[d], event->name);
+
+                            for (int i = 0; i < entryCount; i++)
+                            {
+                                if ((strcmp(entries[i].fontFileName, fileName) == 0) || (strcmp(entries[i].charsetFileName, fileName) == 0))
+                                {
+                                    entries[i].dirty = true;
+                                    changesDetected = true;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                timeout = WATCH_DEBOUNCE_TIME_MS;
+            }
+#else
+            // Files modification time polling, debounced by polling interval
+            WaitTime(WATCH_POLLING_TIME_MS/1000.0);
+
+            FilePathList files = LoadDirectoryFilesEx(dirPath, ".rgs", false);
+            for (unsigned int f = 0; f < files.count; f++)
+            {
+                int index = -1;
+                for (int i = 0; i < entryCount; i++) if (strcmp(entries[i].fileName, files.paths[f]) == 0) { index = i; break; }
+
+                if (index < 0)
+                {
+                    entries = (StyleWatchEntry *)RL_REALLOC(entries, (entryCount + 1)*sizeof(StyleWatchEntry));
+                    memset(&entries[entryCount], 0, sizeof(StyleWatchEntry));
+                    snprintf(entries[entryCount].fileName, 512, "%s", files.paths[f]);
+                    entries[entryCount].dirty = true;
+                    changesDetected = true;
+                    entryCount++;
+                }
+            }
+            UnloadDirectoryFiles(files);
+
+            for (int i = 0; i < entryCount; i++)
+            {
+                long modTime = GetFileModTime(entries[i].fileName);
+                if ((entries[i].fontFileName[0] != '\0') && (GetFileModTime(entries[i].fontFileName) > modTime)) modTime = GetFileModTime(entries[i].fontFileName);
+                if ((entries[i].charsetFileName[0] != '\0') && (GetFileModTime(entries[i].charsetFileName) > modTime)) modTime = GetFileModTime(entries[i].charsetFileName);
+
+                if (modTime != entries[i].modTime) { entries[i].dirty = true; changesDetected = true; }
+            }
+#endif
+        }
+    }
+}
+
+// Compute style content hash, style file and referenced font and charset files (text style)
+// NOTE: Referenced files and modification time are updated on entry, returns 0 if file can not be loaded
+static unsigned long long ComputeStyleWatchHash(StyleWatchEntry *entry)
+{
+    unsigned long long hash = 0;
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(entry->fileName, &fileDataSize);
+
+    entry->fontFileName[0] = '\0';
+    entry->charsetFileName[0] = '\0';
+    entry->modTime = GetFileModTime(entry->fileName);
+
+    if (fileData != NULL)
+    {
+        hash = GuiComputeDataHash(fileData, fileDataSize, 0);
+
+        if (fileData[0] == '#')
+        {
+            // Text style, look for font line: f <gen_font_size> <font_file> <charmap_file>
+            // NOTE: Font and charset file order changed on version 600
+            int version = 0;
+            GuiStyleTextLine line = { 0 };
+
+            for (int i = 0, lineSize = 0; i < fileDataSize; i += lineSize)
+            {
+                lineSize = GuiReadStyleTextLine((const char *)fileData + i, fileDataSize - i, &line);
+
+                if ((line.type == 'v') && (line.valueCount == 1)) version = line.values[0];
+                else if ((line.type == 'f') && (line.valueCount == 1))
+                {
+                    char fontFileName[256] = { 0 };
+                    char charmapFileName[256] = { 0 };
+                    int fontToken = (version >= 600)? 0 : 1;
+
+                    snprintf(fontFileName, 256, "%.*s", line.tokensLength[fontToken], line.tokens[fontToken]);
+                    snprintf(charmapFileName, 256, "%.*s", line.tokensLength[1 - fontToken], line.tokens[1 - fontToken]);
+
+                    if (fontFileName[0] != '\0') snprintf(entry->fontFileName, 512, "%s/%s", GetDirectoryPath(entry->fileName), fontFileName);
+                    if ((charmapFileName[0] != '\0') && (charmapFileName[0] != '0')) snprintf(entry->charsetFileName, 512, "%s/%s", GetDirectoryPath(entry->fileName), charmapFileName);
+                }
+            }
+        }
+
+        UnloadFileData(fileData);
+
+        // Referenced files content added to style hash
+        const char *refFileNames[2] = { entry->fontFileName, entry->charsetFileName };
+        for (int i = 0; i < 2; i++)
+        {
+            if (refFileNames[i][0] == '\0') continue;
+
+            int refDataSize = 0;
+            unsigned char *refData = LoadFileData(refFileNames[i], &refDataSize);
+            if (refData != NULL) hash = GuiComputeDataHash(refData, refDataSize, hash);
+            UnloadFileData(refData);
+
+            long modTime = GetFileModTime(refFileNames[i]);
+            if (modTime > entry->modTime) entry->modTime = modTime;
+        }
+    }
+
+    return hash;
+}
+#endif // PLATFORM_DESKTOP
+
+//--------------------------------------------------------------------------------------------
+// Load/Save/Export data functions
+//--------------------------------------------------------------------------------------------
+// Save current style to memory data array
+// WARNING: Using globals: fontEmbeddedChecked, fontDataCompressed
+static char *SaveStyleToMemory(int *size)
+{
+    // Style File Structure (.rgs v700)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGS "
+    // 4       | 2       | short      | Version: 700
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | Num sections [sectionCount]
+
+    // Sections Directory (20 bytes per section)
+    // foreach (section)
+    // {
+    //   12+20*i | 4     | char       | Section id (FOURCC)
+    //   ...     | 2     | short      | Section codec (0-NONE, 1-DEFLATE, 2-LZ4)
+    //   ...     | 2     | short      | reserved
+    //   ...     | 4     | int        | Section data offset (from file start)
+    //   ...     | 4     | int        | Section data size (stored)
+    //   ...     | 4     | int        | Section data size (decoded)
+    // }
+
+    // Section "HASH": Style content hash (8 bytes), added by SaveStyleSectionsToMemory()
+    // NOTE: XXH64 hash of all sections data following it, used to identify already decoded styles
+
+    // Section "PROP": Properties Data (8 bytes per property)
+    // WARNING: Only properties required that differ from default (light) internal style
+    // foreach (property)
+    // {
+    //   ...     | 2       | short      | ControlId
+    //   ...     | 2       | short      | PropertyId
+    //   ...     | 4       | int        | PropertyValue
+    // }
+
+    // Section "PRPC": Properties Data compact (replaces "PROP" if smaller), see EncodeStylePropsSection()
+
+    // Section "FONT": Custom Font Data Parameters (76 bytes)
+    // NOTE: Font sections are only added if font is embedded
+    // ...     | 32      | char       | Font filename (with extension)
+    // ...     | 4       | int        | Font base size
+    // ...     | 4       | int        | Font glyph count [glyphCount]
+    // ...     | 4       | int        | Font type (0-NORMAL, 1-SDF)
+    // ...     | 16      | Rectangle  | Font white rectangle
+    // ...     | 4       | int        | Image width
+    // ...     | 4       | int        | Image height
+    // ...     | 4       | int        | Image format: GRAY+ALPHA (once loaded)
+    // ...     | 4       | int        | Image data bits per pixel: 16-GRAY+ALPHA, 8-ALPHA, 4/1-ALPHA indexed
+
+    // Section "ATLS": Custom Font Image Data
+    // NOTE: Font image atlas is always converted to GRAY+ALPHA, stored with reduced
+    // bit-depth if lossless (gray channel white) and atlas image data can be compressed (DEFLATE)
+    // 1 and 4 bpp data: alpha palette (2 or 16 bytes) followed by packed indices (MSB first)
+
+    // Section "RECS": Custom Font Recs (16 bytes*glyphCount)
+    // NOTE: Font recs data can be compressed (DEFLATE)
+
+    // Section "RC16": Custom Font Recs packed (8 bytes*glyphCount), replaces "RECS" if all recs fit 16-bit
+    // foreach (glyph)
+    // {
+    //   ...     | 2       | ushort     | Glyph rectangle x
+    //   ...     | 2       | ushort     | Glyph rectangle y
+    //   ...     | 2       | ushort     | Glyph rectangle width
+    //   ...     | 2       | ushort     | Glyph rectangle height
+    // }
+
+    // Section "GLYP": Custom Font Glyph Info (16 bytes*glyphCount)
+    // NOTE: Font glyphs info data can be compressed (DEFLATE)
+    // foreach (glyph)
+    // {
+    //   ...     | 4       | int        | Glyph value
+    //   ...     | 4       | int        | Glyph offset X
+    //   ...     | 4       | int        | Glyph offset Y
+    //   ...     | 4       | int        | Glyph advance X
+    // }
+
+    // Section "GL16": Custom Font Glyph Info packed (10 bytes*glyphCount), replaces "GLYP" if all metrics fit 16-bit
+    // ...     | 4*glyphCount | int     | Glyphs values
+    // foreach (glyph)
+    // {
+    //   ...     | 2       | short      | Glyph offset X
+    //   ...     | 2       | short      | Glyph offset Y
+    //   ...     | 2       | short      | Glyph advance X
+    // }
+    // ------------------------------------------------------
+
+    GuiStyleSection sections[5] = { 0 };
+    int sectionCount = 0;
+
+    // NOTE: Properties buffer allocated for max properties, only changed ones are saved
+    char *propsData = (char *)RL_CALLOC(RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*8, 1);
+    int propsDataSize = 0;
+    int changedPropCounter = 0;
+
+    short controlId = 0;
+    short propertyId = 0;
+    int propertyValue = 0;
+
+    ProfileStageBegin(PROFILE_PROPS_DIFF);
+
+    // Save all properties that have changed in DEFAULT style
+    for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+    {
+        if (defaultStyle[i] != GuiGetStyle(0, i))
+        {
+            propertyId = (short)i;
+            propertyValue = GuiGetStyle(0, i);
+
+            memcpy(propsData + propsDataSize, &controlId, sizeof(short));
+            memcpy(propsData + propsDataSize + 2, &propertyId, sizeof(short));
+            memcpy(propsData + propsDataSize + 4, &propertyValue, sizeof(int));
+            propsDataSize += 8;
+
+            changedPropCounter++;
+        }
+    }
+
+    // Save all properties that have changed in comparison to DEFAULT style
+    for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+        {
+            // NOTE: Check Control property different than default (light) style
+            if (GuiGetStyle(i, j) != defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j])
+            {
+                // Check property is different than its DEFAULT alternative ||
+                // property different than default (light) style DEFAULT alternative
+                if ((GuiGetStyle(i, j) != GuiGetStyle(0, j)) ||
+                    (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != defaultStyle[j]))
+                {
+                    controlId = (short)i;
+                    propertyId = (short)j;
+                    propertyValue = GuiGetStyle(i, j);
+
+                    memcpy(propsData + propsDataSize, &controlId, sizeof(short));
+                    memcpy(propsData + propsDataSize + 2, &propertyId, sizeof(short));
+                    memcpy(propsData + propsDataSize + 4, &propertyValue, sizeof(int));
+                    propsDataSize += 8;
+
+                    changedPropCounter++;
+                }
+            }
+        }
+
+        // NOTE: Extended properties are not shared beetween controls, they are unique, even DEFAULT ones
+        for (int j = RAYGUI_MAX_PROPS_BASE; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+        {
+            if (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j))
+            {
+                controlId = (short)i;
+                propertyId = (short)j;
+                propertyValue = GuiGetStyle(i, j);
+
+                memcpy(propsData + propsDataSize, &controlId, sizeof(short));
+                memcpy(propsData + propsDataSize + 2, &propertyId, sizeof(short));
+                memcpy(propsData + propsDataSize + 4, &propertyValue, sizeof(int));
+                propsDataSize += 8;
+
+                changedPropCounter++;
+            }
+        }
+    }
+
+    ProfileStageEnd(PROFILE_PROPS_DIFF, changedPropCounter*8);
+
+    // Legacy style file requested (--rgs-version 600), readable by raygui 4.0
+    if (styleRgsVersion < 700)
+    {
+        char *buffer = SaveStyleLegacyToMemory((const unsigned char *)propsData, changedPropCounter, size);
+        RL_FREE(propsData);
+
+        return buffer;
+    }
+
+    unsigned char *propsDataCompact = NULL;
+    sections[sectionCount++] = EncodeStylePropsSection((const unsigned char *)propsData, changedPropCounter, &propsDataCompact);
+
+    Image imFont = { 0 };
+    unsigned char fontParams[76] = { 0 };
+    unsigned char *atlasData = NULL;
+    unsigned char *atlasDataCompressed = NULL;
+    unsigned char *recsDataCompressed = NULL;
+    unsigned char *glyphsDataCompressed = NULL;
+    unsigned char *recsData = NULL;
+    unsigned char *glyphsData = NULL;
+
+    // Embed font data if required
+    if (fontEmbeddedChecked && customFontLoaded)
+    {
+        imFont = LoadCustomFontAtlasImage();
+
+        // Make sure font atlas image data is GRAY + ALPHA
+        // WARNING: Should RGBA font data be supported?
+        // NOTE: Atlas data is stored with reduced bit-depth if possible, expanded on loading
+        if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+
+        int atlasBpp = 16;
+        int atlasDataSize = 0;
+        atlasData = EncodeFontAtlasData(imFont, &atlasBpp, &atlasDataSize);
+
+        // Write font parameters
+        int fontType = 0; // 0-NORMAL, 1-SDF
+
+        // Save font filename (32 bytes, with '\0' terminator)
+        char fontName[32] = { 0 };
+        snprintf(fontName, 32, "%s", GetFileName(inFontFileName));
+        if (fontName[0] == '\0') strcpy(fontName, "<NO_FONT_NAME>");
+        memcpy(fontParams, fontName, 32);
+        memcpy(fontParams + 32, &customFont.baseSize, sizeof(int));
+        memcpy(fontParams + 32 + 4, &customFont.glyphCount, sizeof(int));
+        memcpy(fontParams + 32 + 8, &fontType, sizeof(int));
+        memcpy(fontParams + 32 + 12, &fontWhiteRec, sizeof(Rectangle));
+        memcpy(fontParams + 32 + 12 + 16, &imFont.width, sizeof(int));
+        memcpy(fontParams + 32 + 12 + 16 + 4, &imFont.height, sizeof(int));
+        memcpy(fontParams + 32 + 12 + 16 + 8, &imFont.format, sizeof(int));
+        memcpy(fontParams + 32 + 12 + 16 + 12, &atlasBpp, sizeof(int));
+
+        sections[sectionCount++] = (GuiStyleSection){ "FONT", STYLE_CODEC_NONE, 76, 76, fontParams };
+
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+        // NOTE: If data is compressed using raylib CompressData() DEFLATE,
+        // it requires to be decompressed with raylib DecompressData(), that requires
+        // compiling raylib with SUPPORT_COMPRESSION_API config flag enabled,
+        // LZ4 data is decompressed by raygui directly (no dependencies)
+        int fontImageCompSize = 0;
+        const unsigned char *compData = NULL;
+
+        if ((atlasData != NULL) || (fontDataCodec != STYLE_CODEC_DEFLATE))
+        {
+            atlasDataCompressed = CompressSectionData((atlasData != NULL)? atlasData : (const unsigned char *)imFont.data, atlasDataSize, fontDataCodec, &fontImageCompSize);
+            compData = atlasDataCompressed;
+        }
+        else compData = GetFontAtlasCompressedData(imFont, &fontImageCompSize);  // NOTE: Shared with other exporters, no need to free it
+
+        sections[sectionCount++] = (GuiStyleSection){ "ATLS", fontDataCodec, fontImageCompSize, atlasDataSize, compData };
+#else
+        // NOTE: Font atlas image data not compressed
+        sections[sectionCount++] = (GuiStyleSection){ "ATLS", STYLE_CODEC_NONE, atlasDataSize, atlasDataSize, (atlasData != NULL)? atlasData : (const unsigned char *)imFont.data };
+#endif
+        // Font recs and glyphs data, packed 16-bit (8 and 10 bytes per glyph) if possible
+        // NOTE: Only saving some fields from GlyphInfo struct
+        bool glyphsPacked = IsFontGlyphsDataPackable(customFont);
+        int recsDataSize = glyphsPacked? customFont.glyphCount*8 : customFont.glyphCount*sizeof(Rectangle);
+        int glyphsDataSize = glyphsPacked? customFont.glyphCount*10 : customFont.glyphCount*4*sizeof(int);
+        recsData = (unsigned char *)RL_CALLOC(recsDataSize, 1);
+        glyphsData = (unsigned char *)RL_CALLOC(glyphsDataSize, 1);
+
+        for (int i = 0; i < customFont.glyphCount; i++)
+        {
+            if (glyphsPacked)
+            {
+                unsigned short rec[4] = { (unsigned short)customFont.recs[i].x, (unsigned short)customFont.recs[i].y,
+                                          (unsigned short)customFont.recs[i].width, (unsigned short)customFont.recs[i].height };
+                short metrics[3] = { (short)customFont.glyphs[i].offsetX, (short)customFont.glyphs[i].offsetY, (short)customFont.glyphs[i].advanceX };
+
+                memcpy(recsData + i*8, rec, 8);
+                memcpy(glyphsData + i*4, &customFont.glyphs[i].value, 4);
+                memcpy(glyphsData + customFont.glyphCount*4 + i*6, metrics, 6);
+            }
+            else
+            {
+                int glyph[4] = { customFont.glyphs[i].value, customFont.glyphs[i].offsetX, customFont.glyphs[i].offsetY, customFont.glyphs[i].advanceX };
+
+                memcpy(recsData + i*16, &customFont.recs[i], 16);
+                memcpy(glyphsData + i*16, glyph, 16);
+            }
+        }
+
+        // Compress font recs and glyphs data if required
+        int recsDataCompSize = 0;
+        int glyphsDataCompSize = 0;
+
+        if (fontDataCompressedChecked)
+        {
+            recsDataCompressed = CompressSectionData(recsData, recsDataSize, fontDataCodec, &recsDataCompSize);
+            glyphsDataCompressed = CompressSectionData(glyphsData, glyphsDataSize, fontDataCodec, &glyphsDataCompSize);
+        }
+
+        if (recsDataCompressed != NULL) sections[sectionCount++] = (GuiStyleSection){ "RECS", fontDataCodec, recsDataCompSize, recsDataSize, recsDataCompressed };
+        else sections[sectionCount++] = (GuiStyleSection){ "RECS", STYLE_CODEC_NONE, recsDataSize, recsDataSize, recsData };
+
+        if (glyphsDataCompressed != NULL) sections[sectionCount++] = (GuiStyleSection){ "GLYP", fontDataCodec, glyphsDataCompSize, glyphsDataSize, glyphsDataCompressed };
+        else sections[sectionCount++] = (GuiStyleSection){ "GLYP", STYLE_CODEC_NONE, glyphsDataSize, glyphsDataSize, glyphsData };
+
+        if (glyphsPacked)
+        {
+            memcpy(sections[sectionCount - 2].id, "RC16", 4);
+            memcpy(sections[sectionCount - 1].id, "GL16", 4);
+        }
+    }
+
+    // Write all sections, buffer allocated with exact style size
+    char *buffer = SaveStyleSectionsToMemory(sections, sectionCount, size);
+
+    UnloadImage(imFont);
+    RL_FREE(atlasData);
+    RL_FREE(atlasDataCompressed);
+    RL_FREE(recsDataCompressed);
+    RL_FREE(glyphsDataCompressed);
+    RL_FREE(recsData);
+    RL_FREE(glyphsData);
+    RL_FREE(propsData);
+    RL_FREE(propsDataCompact);
+
+    return buffer;
+}
+
+// Save style sections to memory data array (.rgs v700)
+// NOTE: Content hash section (HASH) is always added first, provided sections data is written
+// in the provided order after it, hash is computed from all sections data following it
+static char *SaveStyleSectionsToMemory(const GuiStyleSection *sections, int sectionCount, int *size)
+{
+    #define GUI_STYLE_RGS_VERSION   700
+
+    int fileSectionCount = sectionCount + 1;
+    int dataSize = 12 + fileSectionCount*20 + 8;
+    for (int i = 0; i < sectionCount; i++) dataSize += sections[i].size;
+
+    char *buffer = (char *)RL_CALLOC(dataSize, 1);
+
+    short version = GUI_STYLE_RGS_VERSION;
+    memcpy(buffer, "rGS ", 4);
+    memcpy(buffer + 4, &version, sizeof(short));
+    memcpy(buffer + 8, &fileSectionCount, sizeof(int));
+
+    int hashOffset = 12 + fileSectionCount*20;
+    int offset = hashOffset;
+
+    for (int i = -1; i < sectionCount; i++)
+    {
+        GuiStyleSection section = (i < 0)? (GuiStyleSection){ "HASH", STYLE_CODEC_NONE, 8, 8, NULL } : sections[i];
+        short codec = (short)section.codec;
+        char *entry = buffer + 12 + (i + 1)*20;
+
+        memcpy(entry, section.id, 4);
+        memcpy(entry + 4, &codec, sizeof(short));
+        memcpy(entry + 8, &offset, sizeof(int));
+        memcpy(entry + 12, &section.size, sizeof(int));
+        memcpy(entry + 16, &section.dataSize, sizeof(int));
+
+        if ((section.size > 0) && (section.data != NULL)) memcpy(buffer + offset, section.data, section.size);
+        offset += section.size;
+    }
+
+    unsigned long long hash = GuiComputeDataHash((const unsigned char *)buffer + hashOffset + 8, dataSize - hashOffset - 8, 0);
+    memcpy(buffer + hashOffset, &hash, 8);
+
+    *size = dataSize;
+    return buffer;
+}
+
+// Save style properties and font data to memory data array (.rgs v600)
+// NOTE: Legacy layout, readable by raygui 4.0: properties are not compacted, font atlas is
+// stored as GRAY+ALPHA and compressed data always uses DEFLATE (no LZ4 support on v600 readers)
+static char *SaveStyleLegacyToMemory(const unsigned char *propsData, int propertyCount, int *size)
+{
+    // Style File Structure (.rgs v600)
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGS "
+    // 4       | 2       | short      | Version: 600
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | Num properties [propertyCount]
+    // 12      | 8*count | -          | Properties data (same as "PROP" section)
+    // ...     | 4       | int        | Font data size (0 - no font, no more fields added!)
+    // ...     | 32      | char       | Font filename (with extension)
+    // ...     | 28      | -          | Font base size, glyph count, type and white rectangle
+    // ...     | 20      | int        | Image data size (uncomp), image data size (comp), width, height, format
+    // ...     | imSize  | byte       | Image data (comp or uncomp)
+    // ...     | 4       | int        | Recs data compressed size (0 - not compressed)
+    // ...     | ...     | byte       | Recs data (16 bytes*glyphCount uncompressed)
+    // ...     | 4       | int        | Glyphs data compressed size (0 - not compressed)
+    // ...     | ...     | byte       | Glyphs data (16 bytes*glyphCount uncompressed)
+    // ------------------------------------------------------
+
+    Image imFont = { 0 };
+    const unsigned char *atlasData = NULL;
+    unsigned char *recsDataCompressed = NULL;
+    unsigned char *glyphsDataCompressed = NULL;
+    int *glyphsData = NULL;
+    int fontImageUncompSize = 0;
+    int fontImageCompSize = 0;
+    int recsDataSize = 0;
+    int glyphsDataSize = 0;
+    int recsDataCompSize = 0;
+    int glyphsDataCompSize = 0;
+    int fontDataSize = 0;
+
+    if (fontEmbeddedChecked && customFontLoaded)
+    {
+        imFont = LoadCustomFontAtlasImage();
+        if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+
+        fontImageUncompSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+        atlasData = GetFontAtlasCompressedData(imFont, &fontImageCompSize);    // NOTE: Shared with other exporters, no need to free it
+#else
+        atlasData = (const unsigned char *)imFont.data;
+        fontImageCompSize = fontImageUncompSize;
+#endif
+        // Font recs and glyphs data (16 bytes per glyph each one)
+        recsDataSize = customFont.glyphCount*sizeof(Rectangle);
+        glyphsDataSize = customFont.glyphCount*4*sizeof(int);
+        glyphsData = (int *)RL_CALLOC(customFont.glyphCount*4, sizeof(int));
+
+        for (int i = 0; i < customFont.glyphCount; i++)
+        {
+            glyphsData[4*i + 0] = customFont.glyphs[i].value;
+            glyphsData[4*i + 1] = customFont.glyphs[i].offsetX;
+            glyphsData[4*i + 2] = customFont.glyphs[i].offsetY;
+            glyphsData[4*i + 3] = customFont.glyphs[i].advanceX;
+        }
+
+        if (fontDataCompressedChecked)
+        {
+            recsDataCompressed = CompressSectionData((const unsigned char *)customFont.recs, recsDataSize, STYLE_CODEC_DEFLATE, &recsDataCompSize);
+            glyphsDataCompressed = CompressSectionData((const unsigned char *)glyphsData, glyphsDataSize, STYLE_CODEC_DEFLATE, &glyphsDataCompSize);
+        }
+
+        // NOTE: Font data size is only used by readers to check font data is included
+        fontDataSize = 64 + fontImageCompSize + recsDataSize + glyphsDataSize;
+    }
+
+    int dataSize = 12 + propertyCount*8 + 4;
+    if (fontDataSize > 0) dataSize += (32 + 28 + 20 + fontImageCompSize + 8 +
+        ((recsDataCompressed != NULL)? recsDataCompSize : recsDataSize) +
+        ((glyphsDataCompressed != NULL)? glyphsDataCompSize : glyphsDataSize));
+
+    char *buffer = (char *)RL_CALLOC(dataSize, 1);
+    int offset = 0;
+
+    short version = 600;
+    memcpy(buffer, "rGS ", 4);
+    memcpy(buffer + 4, &version, sizeof(short));
+    memcpy(buffer + 8, &propertyCount, sizeof(int));
+    if (propertyCount > 0) memcpy(buffer + 12, propsData, propertyCount*8);
+    offset = 12 + propertyCount*8;
+
+    memcpy(buffer + offset, &fontDataSize, sizeof(int));
+    offset += 4;
+
+    if (fontDataSize > 0)
+    {
+        // Save font filename (32 bytes, with '\0' terminator)
+        char fontName[32] = { 0 };
+        snprintf(fontName, 32, "%s", GetFileName(inFontFileName));
+        if (fontName[0] == '\0') strcpy(fontName, "<NO_FONT_NAME>");
+        memcpy(buffer + offset, fontName, 32);
+        offset += 32;
+
+        int fontType = 0; // 0-NORMAL, 1-SDF
+        memcpy(buffer + offset, &customFont.baseSize, sizeof(int));
+        memcpy(buffer + offset + 4, &customFont.glyphCount, sizeof(int));
+        memcpy(buffer + offset + 8, &fontType, sizeof(int));
+        memcpy(buffer + offset + 12, &fontWhiteRec, sizeof(Rectangle));
+        offset += 28;
+
+        memcpy(buffer + offset, &fontImageUncompSize, sizeof(int));
+        memcpy(buffer + offset + 4, &fontImageCompSize, sizeof(int));
+        memcpy(buffer + offset + 8, &imFont.width, sizeof(int));
+        memcpy(buffer + offset + 12, &imFont.height, sizeof(int));
+        memcpy(buffer + offset + 16, &imFont.format, sizeof(int));
+        memcpy(buffer + offset + 20, atlasData, fontImageCompSize);
+        offset += (20 + fontImageCompSize);
+
+        memcpy(buffer + offset, &recsDataCompSize, sizeof(int));
+        if (recsDataCompressed != NULL) memcpy(buffer + offset + 4, recsDataCompressed, recsDataCompSize);
+        else memcpy(buffer + offset + 4, customFont.recs, recsDataSize);
+        offset += (4 + ((recsDataCompressed != NULL)? recsDataCompSize : recsDataSize));
+
+        memcpy(buffer + offset, &glyphsDataCompSize, sizeof(int));
+        if (glyphsDataCompressed != NULL) memcpy(buffer + offset + 4, glyphsDataCompressed, glyphsDataCompSize);
+        else memcpy(buffer + offset + 4, glyphsData, glyphsDataSize);
+    }
+
+    UnloadImage(imFont);
+    RL_FREE(recsDataCompressed);
+    RL_FREE(glyphsDataCompressed);
+    RL_FREE(glyphsData);
+
+    *size = dataSize;
+    return buffer;
+}
+
+// Encode style properties section (.rgs v700), compact if possible
+// NOTE: Compact properties section (PRPC) requires records sorted by control and property (as saved),
+// every record: byte header [varint control delta] [varint property delta] value
+//  - header: value kind (bits 7-6), new control (bit 5), property delta (bits 4-0, 31: varint follows)
+//  - value kind 0: varint (zigzag), small integer values
+//  - value kind 1: varint back-reference to a previous value (distance from last one), repeated colors
+//  - value kind 2: int value, new color (added to previous values)
+//  - value kind 3: varint back-reference and byte alpha, color changing alpha (added to previous values)
+// Returned section points to properties data (PROP) or compact data (PRPC), compact data must be freed
+static GuiStyleSection EncodeStylePropsSection(const unsigned char *propsData, int propertyCount, unsigned char **compactData)
+{
+    GuiStyleSection section = { "PROP", STYLE_CODEC_NONE, propertyCount*8, propertyCount*8, propsData };
+
+    // NOTE: Worst case compact record size: header, 2 varints (3 bytes) and int value
+    unsigned char *data = (unsigned char *)RL_CALLOC(propertyCount*11 + 1, 1);
+    unsigned int *values = (unsigned int *)RL_CALLOC(propertyCount + 1, sizeof(unsigned int));     // Previous values, for back-references
+    int valuesCount = 0;
+    int dataSize = 0;
+
+    int prevControlId = 0;
+    int prevPropertyId = -1;
+    bool sorted = true;
+
+    for (int i = 0; (i < propertyCount) && sorted; i++)
+    {
+        unsigned short ids[2] = { 0 };
+        unsigned int value = 0;
+        memcpy(ids, propsData + i*8, 4);
+        memcpy(&value, propsData + i*8 + 4, sizeof(unsigned int));
+
+        int controlId = ids[0];
+        int propertyId = ids[1];
+
+        // Check records order, compact encoding requires ascending control and property ids
+        if ((controlId < prevControlId) || ((controlId == prevControlId) && (propertyId <= prevPropertyId))) { sorted = false; break; }
+
+        unsigned int varints[3] = { 0 };
+        int varintsCount = 0;
+        int header = 0;
+
+        if (controlId != prevControlId)
+        {
+            header |= 0x20;
+            varints[varintsCount++] = controlId - prevControlId;
+            prevPropertyId = -1;
+        }
+
+        int propertyDelta = propertyId - prevPropertyId - 1;
+        if (propertyDelta < 31) header |= propertyDelta;
+        else
+        {
+            header |= 31;
+            varints[varintsCount++] = propertyDelta;
+        }
+
+        // Select value kind: small integer, repeated value, same color with different alpha or new value
+        unsigned int zigzag = (value << 1) ^ (unsigned int)((int)value >> 31);
+        int reference = -1;
+        int kind = 2;
+
+        if (zigzag < (1 << 14)) kind = 0;
+        else
+        {
+            for (int v = valuesCount - 1; v >= 0; v--) if (values[v] == value) { reference = valuesCount - 1 - v; kind = 1; break; }
+
+            if (reference < 0)
+            {
+                for (int v = valuesCount - 1; v >= 0; v--) if ((values[v] & 0xffffff00) == (value & 0xffffff00)) { reference = valuesCount - 1 - v; kind = 3; break; }
+            }
+        }
+
+        if (kind == 0) varints[varintsCount++] = zigzag;
+        else if ((kind == 1) || (kind == 3)) varints[varintsCount++] = (unsigned int)reference;
+
+        data[dataSize++] = (unsigned char)((kind << 6) | header);
+
+        for (int v = 0; v < varintsCount; v++)
+        {
+            unsigned int varint = varints[v];
+            for (; varint >= 0x80; varint >>= 7) data[dataSize++] = (unsigned char)((varint & 0x7f) | 0x80);
+            data[dataSize++] = (unsigned char)varint;
+        }
+
+        if (kind == 2)
+        {
+            memcpy(data + dataSize, &value, sizeof(unsigned int));
+            dataSize += 4;
+        }
+        else if (kind == 3) data[dataSize++] = (unsigned char)(value & 0xff);
+
+        if ((kind == 2) || (kind == 3)) values[valuesCount++] = value;
+
+        prevControlId = controlId;
+        prevPropertyId = propertyId;
+    }
+
+    RL_FREE(values);
+
+    if (sorted && (dataSize < propertyCount*8))
+    {
+        section = (GuiStyleSection){ "PRPC", STYLE_CODEC_NONE, dataSize, dataSize, data };
+        *compactData = data;
+    }
+    else
+    {
+        RL_FREE(data);
+        *compactData = NULL;
+    }
+
+    return section;
+}
+
+// Save raygui style binary file (.rgs)
+// NOTE: By default style is saved as binary file but
+// a text style mode is also available for debug (no font embedding)
+static int SaveStyle(const char *fileName, int format)
+{
+    #define GUI_STYLE_RGS_VERSION   700
+
+    int result = 0;
+
+    if (format == STYLE_BINARY)
+    {
+        int rgsFileDataSize = 0;
+        char *rgsFileData = SaveStyleToMemory(&rgsFileDataSize);
+
+        result = SaveFileData(fileName, rgsFileData, rgsFileDataSize);
+
+        RL_FREE(rgsFileData);
+    }
+    else if (format == STYLE_TEXT)
+    {
+        // NOTE: Text built in memory and written at once, buffer sized from changed properties
+        // (one line per property), grown if required
+        TextBuffer text = { 0 };
+        text.capacity = 1024 + CountStyleChangesDefault()*96;
+        text.data = (char *)RL_CALLOC(text.capacity, 1);
+
+        // Write some description comments
+        TextBufferAppend(&text, "#\n# rgs style text file - raygui style file generated using rGuiStyler\n#\n", -1);
+        TextBufferAppend(&text, "# Provided info:\n", -1);
+        TextBufferAppend(&text, "#    f <fontGenSize> <fontFileName> <charsetFileName>\n", -1);
+        TextBufferAppend(&text, "#    p <controlId> <propertyId> <propertyValue>  Property description\n#\n", -1);
+
+        if (customFontLoaded)
+        {
+            TextBufferAppend(&text, "# WARNING: This style uses a custom font, must be provided with style file\n#\n", -1);
+            TextBufferAppend(&text, TextFormat("v %i\n", GUI_STYLE_RGS_VERSION), -1);
+
+            // Save charset into an external file
+            // NOTE: Only saving charset if not basic one (95 codepoints)
+            // WARNING: codepointList and codepointListCount are global variables in gui_window_font_atlas module
+            if (codepointListCount > 95)
+            {
+                // Charset data size computed first, codepoints encoded as UTF-8 into an exact size buffer
+                int charsetSize = 0;
+                int valueSize = 0;
+
+                for (int i = 0; i < codepointListCount; i++)
+                {
+                    CodepointToUTF8(codepointList[i], &valueSize);
+                    charsetSize += valueSize;
+                }
+
+                char *charsetData = (char *)RL_CALLOC(charsetSize + 1, 1);
+
+                for (int i = 0, k = 0; i < codepointListCount; i++, k += valueSize)
+                {
+                    const char *value = CodepointToUTF8(codepointList[i], &valueSize);
+                    memcpy(charsetData + k, value, valueSize);
+                }
+
+                // Save charset data
+                SaveFileData(TextFormat("%s/charset.txt", GetDirectoryPath(fileName)), charsetData, charsetSize);
+
+                RL_FREE(charsetData);
+            }
+
+            if (FileExists(TextFormat("%s/charset.txt", GetDirectoryPath(fileName)))) // Check charset.txt saved successfully
+            {
+                TextBufferAppend(&text, TextFormat("f %i %s %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), GetFileName(inFontFileName), "charset.txt"), -1);
+            }
+            else TextBufferAppend(&text, TextFormat("f %i %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), GetFileName(inFontFileName)), -1);
+        }
+        else TextBufferAppend(&text, TextFormat("#\nv %i\n", GUI_STYLE_RGS_VERSION), -1);
+
+        // Save DEFAULT properties that changed
+        for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+        {
+            if (defaultStyle[i] != GuiGetStyle(0, i))
+            {
+                // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
+                TextBufferAppendProperty(&text, 0, i, GuiGetStyle(0, i));
+
+                if (i < RAYGUI_MAX_PROPS_BASE)
+                {
+                    TextBufferAppend(&text, "DEFAULT_", -1);
+                    TextBufferAppend(&text, guiProps[i].name, -1);
+                }
+                else TextBufferAppend(&text, guiPropsDefaultExtended[i - RAYGUI_MAX_PROPS_BASE].name, -1);
+
+                TextBufferAppend(&text, " \n", 2);
+            }
+        }
+
+        // Save all properties that have changed in comparison to default style
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+            {
+                // NOTE: Check Control property different than default (light) style
+                if (GuiGetStyle(i, j) != defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j])
+                {
+                    // Check property is different than its DEFAULT alternative ||
+                    // property different than default (light) style DEFAULT alternative
+                    if ((GuiGetStyle(i, j) != GuiGetStyle(0, j)) ||
+                        (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != defaultStyle[j]))
+                    {
+                        // NOTE: Control properties are written as hexadecimal values
+                        TextBufferAppendProperty(&text, i, j, GuiGetStyle(i, j));
+                        TextBufferAppend(&text, guiControlText[i], -1);
+                        TextBufferAppend(&text, "_", 1);
+                        TextBufferAppend(&text, guiProps[j].name, -1);
+                        TextBufferAppend(&text, " \n", 2);
+                    }
+                }
+            }
+
+            // NOTE: Extended properties are not shared beetween controls, they are unique, even DEFAULT ones
+            for (int j = RAYGUI_MAX_PROPS_BASE; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+            {
+                if (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j))
+                {
+                    // NOTE: Extended properties written as property lines, same as base properties
+                    TextBufferAppendProperty(&text, i, j, GuiGetStyle(i, j));
+                    TextBufferAppend(&text, guiControlText[i], -1);
+                    TextBufferAppend(&text, TextFormat("_EXTENDED%02i \n", j - RAYGUI_MAX_PROPS_BASE + 1), -1);
+                }
+            }
+        }
+
+        result = SaveFileText(fileName, text.data);
+
+        RL_FREE(text.data);
+    }
+
+    return result;
+}
+
+// Upgrade legacy binary style data (v200, v400, v600) to current version (v700)
+// NOTE: Data is streamed section by section: properties and compressed sections (atlas, recs, glyphs)
+// are copied verbatim, only uncompressed sections are compressed (same as SaveStyleToMemory() output),
+// no decompression required, returns NULL if data is not a valid binary style
+static unsigned char *UpgradeStyleFromMemory(const unsigned char *fileData, int dataSize, int *upgradedDataSize)
+{
+    #define GUI_STYLE_RGS_VERSION   700
+
+    short version = 0;
+    int propertyCount = 0;
+
+    *upgradedDataSize = 0;
+
+    if ((fileData == NULL) || (dataSize < 12) ||
+        (fileData[0] != 'r') || (fileData[1] != 'G') || (fileData[2] != 'S') || (fileData[3] != ' ')) return NULL;
+
+    memcpy(&version, fileData + 4, sizeof(short));
+    memcpy(&propertyCount, fileData + 8, sizeof(int));
+
+    if (version >= GUI_STYLE_RGS_VERSION)
+    {
+        // Current version, nothing to upgrade
+        unsigned char *buffer = (unsigned char *)RL_CALLOC(dataSize, 1);
+        memcpy(buffer, fileData, dataSize);
+        *upgradedDataSize = dataSize;
+
+        return buffer;
+    }
+
+    int propsDataSize = 12 + propertyCount*8;   // Header and properties data size
+    int fontDataSize = 0;
+
+    if ((propertyCount < 0) || ((propsDataSize + 4) > dataSize)) return NULL;
+    memcpy(&fontDataSize, fileData + propsDataSize, sizeof(int));
+
+    GuiStyleSection sections[5] = { 0 };
+    int sectionCount = 0;
+    unsigned char *compData[3] = { 0 };         // Sections compressed on upgrade: atlas, recs, glyphs
+    unsigned char fontParams[76] = { 0 };
+
+    // Properties data copied verbatim, compact encoded if possible
+    unsigned char *propsDataCompact = NULL;
+    sections[sectionCount++] = EncodeStylePropsSection(fileData + 12, propertyCount, &propsDataCompact);
+
+    if (fontDataSize > 0)
+    {
+        // Font parameters: file name (32 bytes, VERSION: >=600), base size, glyph count, type,
+        // white rectangle (28 bytes) and font atlas image parameters (20 bytes)
+        int glyphCount = 0;
+        int imParams[5] = { 0 };    // Image data size (uncomp), image data size (comp), width, height, format
+        int inOffset = propsDataSize + 4;
+
+        if (version >= 600)
+        {
+            if ((inOffset + 32) > dataSize) { RL_FREE(propsDataCompact); return NULL; }
+            memcpy(fontParams, fileData + inOffset, 32);
+            inOffset += 32;
+        }
+        else memcpy(fontParams, "<NO_FONT_NAME>", 14);  // Font file name not available on legacy versions
+
+        if ((inOffset + 48) > dataSize) { RL_FREE(propsDataCompact); return NULL; }
+        memcpy(&glyphCount, fileData + inOffset + 4, sizeof(int));
+        memcpy(imParams, fileData + inOffset + 28, 5*sizeof(int));
+        memcpy(fontParams + 32, fileData + inOffset, 28);
+        memcpy(fontParams + 32 + 28, imParams + 2, 3*sizeof(int));
+        memcpy(fontParams + 32 + 28 + 12, &(int){ 16 }, sizeof(int));   // Atlas data bits per pixel: GRAY+ALPHA
+        inOffset += 48;
+
+        sections[sectionCount++] = (GuiStyleSection){ "FONT", STYLE_CODEC_NONE, 76, 76, fontParams };
+
+        // Font atlas image data
+        bool atlasCompressed = (imParams[1] > 0) && (imParams[1] != imParams[0]);
+        int atlasDataSize = atlasCompressed? imParams[1] : imParams[0];
+        if ((glyphCount < 0) || (atlasDataSize < 0) || ((inOffset + atlasDataSize) > dataSize)) { RL_FREE(propsDataCompact); return NULL; }
+
+        if (atlasCompressed) sections[sectionCount++] = (GuiStyleSection){ "ATLS", STYLE_CODEC_DEFLATE, atlasDataSize, imParams[0], fileData + inOffset };
+        else
+        {
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+            int compDataSize = 0;
+            compData[0] = CompressSectionData(fileData + inOffset, atlasDataSize, fontDataCodec, &compDataSize);
+            sections[sectionCount++] = (GuiStyleSection){ "ATLS", fontDataCodec, compDataSize, atlasDataSize, compData[0] };
+#else
+            sections[sectionCount++] = (GuiStyleSection){ "ATLS", STYLE_CODEC_NONE, atlasDataSize, atlasDataSize, fileData + inOffset };
+#endif
+        }
+
+        inOffset += atlasDataSize;
+
+        // Font recs and glyphs data (16 bytes per glyph each one)
+        // NOTE: Version 400 adds the compression size parameter (0 - not compressed)
+        for (int section = 0; section < 2; section++)
+        {
+            const char *sectionId = (section == 0)? "RECS" : "GLYP";
+            int sectionSize = glyphCount*16;
+            int sectionCompSize = 0;
+
+            if (version >= 400)
+            {
+                if ((inOffset + 4) > dataSize) { for (int i = 0; i < 3; i++) MemFree(compData[i]); RL_FREE(propsDataCompact); return NULL; }
+                memcpy(&sectionCompSize, fileData + inOffset, sizeof(int));
+                inOffset += 4;
+            }
+
+            bool sectionCompressed = (sectionCompSize > 0) && (sectionCompSize != sectionSize);
+            int sectionDataSize = sectionCompressed? sectionCompSize : sectionSize;
+            if ((sectionDataSize < 0) || ((inOffset + sectionDataSize) > dataSize)) { for (int i = 0; i < 3; i++) MemFree(compData[i]); RL_FREE(propsDataCompact); return NULL; }
+
+            GuiStyleSection styleSection = { 0 };
+            memcpy(styleSection.id, sectionId, 4);
+            styleSection.dataSize = sectionSize;
+
+            if (!sectionCompressed && fontDataCompressedChecked)
+            {
+                compData[1 + section] = CompressSectionData(fileData + inOffset, sectionSize, fontDataCodec, &styleSection.size);
+                styleSection.codec = fontDataCodec;
+                styleSection.data = compData[1 + section];
+            }
+            else
+            {
+                styleSection.codec = sectionCompressed? STYLE_CODEC_DEFLATE : STYLE_CODEC_NONE;
+                styleSection.size = sectionDataSize;
+                styleSection.data = fileData + inOffset;
+            }
+
+            sections[sectionCount++] = styleSection;
+            inOffset += sectionDataSize;
+        }
+    }
+
+    unsigned char *buffer = (unsigned char *)SaveStyleSectionsToMemory(sections, sectionCount, upgradedDataSize);
+
+    for (int i = 0; i < 3; i++) MemFree(compData[i]);
+    RL_FREE(propsDataCompact);
+
+    return buffer;
+}
+
+// Upgrade legacy binary style file to current version
+// NOTE: Text styles are not upgraded, returns output file size (0 on failure)
+static int UpgradeStyleFile(const char *inFile, const char *outFile)
+{
+    int outputSize = 0;
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(inFile, &fileDataSize);
+
+    int upgradedDataSize = 0;
+    unsigned char *upgradedData = UpgradeStyleFromMemory(fileData, fileDataSize, &upgradedDataSize);
+    UnloadFileData(fileData);
+
+    if ((upgradedData != NULL) && SaveFileData(outFile, upgradedData, upgradedDataSize)) outputSize = upgradedDataSize;
+
+    RL_FREE(upgradedData);
+
+    return outputSize;
+}
+
+// Patch binary style properties with provided edits
+// NOTE: Only properties table is rewritten, font data is copied verbatim (no decompression required),
+// edits are applied as GuiSetStyle() calls after loading the style: a DEFAULT base property edit
+// is propagated to all controls (controls records removed), records not required are removed
+// (value equal to loaded value without record) and records are written sorted by control and property
+// (same as SaveStyleToMemory()), returns NULL if data is not a valid binary style
+// NOTE: Version 700 styles only rewrite the properties section, other sections copied verbatim
+static unsigned char *PatchStyleFromMemory(const unsigned char *fileData, int dataSize, const StylePropEdit *edits, int editsCount, int *patchedDataSize)
+{
+    #define STYLE_PROPS_STRIDE  (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)
+
+    int propertyCount = 0;
+    unsigned int propsValue[RAYGUI_MAX_CONTROLS*STYLE_PROPS_STRIDE] = { 0 };
+    bool propsRecord[RAYGUI_MAX_CONTROLS*STYLE_PROPS_STRIDE] = { 0 };  // Property record available in properties table
+
+    *patchedDataSize = 0;
+
+    if ((fileData == NULL) || (dataSize < 12) ||
+        (fileData[0] != 'r') || (fileData[1] != 'G') || (fileData[2] != 'S') || (fileData[3] != ' ')) return NULL;
+
+    short version = 0;
+    memcpy(&version, fileData + 4, sizeof(short));
+    memcpy(&propertyCount, fileData + 8, sizeof(int));
+
+    const unsigned char *propsData = fileData + 12;
+    unsigned char *propsDataDecoded = NULL;
+    int propsDataSize = 12 + propertyCount*8;   // Header and properties data size (legacy versions)
+
+    if (version >= 700)
+    {
+        // WARNING: Version 700 properties are stored in their own section, header count is the sections count
+        if ((propertyCount < 0) || (propertyCount > (dataSize - 12)/20)) return NULL;
+
+        // NOTE: Properties records decoded from properties section (PROP) or compact section (PRPC)
+        propsDataDecoded = GuiLoadStyleProps(fileData, dataSize, &propertyCount);
+        propsData = propsDataDecoded;
+    }
+    else if ((propertyCount < 0) || (propsDataSize > dataSize)) return NULL;
+
+    // Load properties records, last record prevails in case of duplicates
+    for (int i = 0; i < propertyCount; i++)
+    {
+        short controlId = 0;
+        short propertyId = 0;
+        unsigned int propertyValue = 0;
+
+        memcpy(&controlId, propsData + i*8, sizeof(short));
+        memcpy(&propertyId, propsData + i*8 + 2, sizeof(short));
+        memcpy(&propertyValue, propsData + i*8 + 4, sizeof(int));
+
+        if ((controlId < 0) || (controlId >= RAYGUI_MAX_CONTROLS) || (propertyId < 0) || (propertyId >= STYLE_PROPS_STRIDE))
+        {
+            RL_FREE(propsDataDecoded);
+            return NULL;
+        }
+
+        propsValue[controlId*STYLE_PROPS_STRIDE + propertyId] = propertyValue;
+        propsRecord[controlId*STYLE_PROPS_STRIDE + propertyId] = true;
+    }
+
+    RL_FREE(propsDataDecoded);
+
+    // Apply properties edits
+    for (int e = 0; e < editsCount; e++)
+    {
+        int controlId = edits[e].controlId;
+        int propertyId = edits[e].propertyId;
+        int index = controlId*STYLE_PROPS_STRIDE + propertyId;
+
+        if ((controlId < 0) || (controlId >= RAYGUI_MAX_CONTROLS) || (propertyId < 0) || (propertyId >= STYLE_PROPS_STRIDE)) continue;
+
+        propsValue[index] = (unsigned int)edits[e].propertyValue;
+        propsRecord[index] = true;
+
+        if ((controlId == 0) && (propertyId < RAYGUI_MAX_PROPS_BASE))
+        {
+            // DEFAULT base property is propagated to all controls, controls records not required anymore
+            // NOTE: Record can be removed only if all controls default (light) values are the same
+            bool recordRequired = (propsValue[index] != defaultStyle[propertyId]);
+
+            for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+            {
+                propsRecord[i*STYLE_PROPS_STRIDE + propertyId] = false;
+                if (defaultStyle[i*STYLE_PROPS_STRIDE + propertyId] != defaultStyle[propertyId]) recordRequired = true;
+            }
+
+            propsRecord[index] = recordRequired;
+        }
+        else
+        {
+            // Property value without record: DEFAULT record (base properties) or default (light) style
+            unsigned int value = defaultStyle[index];
+            if ((propertyId < RAYGUI_MAX_PROPS_BASE) && propsRecord[propertyId]) value = propsValue[propertyId];
+
+            if (propsValue[index] == value) propsRecord[index] = false;
+        }
+    }
+
+    int patchedPropCount = 0;
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS*STYLE_PROPS_STRIDE; i++) if (propsRecord[i]) patchedPropCount++;
+
+    // Properties table rewritten, header added for legacy versions
+    int headerSize = (version >= 700)? 0 : 12;
+    unsigned char *patchedProps = (unsigned char *)RL_CALLOC(headerSize + patchedPropCount*8, 1);
+    int outOffset = headerSize;
+
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS*STYLE_PROPS_STRIDE; i++)
+    {
+        if (!propsRecord[i]) continue;
+
+        short controlId = (short)(i/STYLE_PROPS_STRIDE);
+        short propertyId = (short)(i%STYLE_PROPS_STRIDE);
+
+        memcpy(patchedProps + outOffset, &controlId, sizeof(short));
+        memcpy(patchedProps + outOffset + 2, &propertyId, sizeof(short));
+        memcpy(patchedProps + outOffset + 4, &propsValue[i], sizeof(int));
+        outOffset += 8;
+    }
+
+    unsigned char *buffer = NULL;
+
+    if (version >= 700)
+    {
+        // Sections rewritten in file order, other sections (font) copied verbatim
+        int sectionCount = 0;
+        memcpy(&sectionCount, fileData + 8, sizeof(int));
+        GuiStyleSection *sections = (GuiStyleSection *)RL_CALLOC(sectionCount + 1, sizeof(GuiStyleSection));
+        int count = 0;
+
+        for (int i = 0; i < sectionCount; i++)
+        {
+            char id[5] = { 0 };
+            memcpy(id, fileData + 12 + i*20, 4);
+
+            // NOTE: Content hash section is computed again on saving
+            if ((strcmp(id, "PROP") == 0) || (strcmp(id, "PRPC") == 0) || (strcmp(id, "HASH") == 0)) continue;
+            sections[count] = GuiGetStyleSection(fileData, dataSize, id);
+            if (sections[count].data != NULL) count++;
+        }
+
+        // NOTE: Properties section is always written first, to be applied before font data is decoded
+        memmove(sections + 1, sections, count*sizeof(GuiStyleSection));
+        unsigned char *patchedPropsCompact = NULL;
+        sections[0] = EncodeStylePropsSection(patchedProps, patchedPropCount, &patchedPropsCompact);
+
+        buffer = (unsigned char *)SaveStyleSectionsToMemory(sections, count + 1, patchedDataSize);
+
+        RL_FREE(patchedPropsCompact);
+        RL_FREE(sections);
+    }
+    else
+    {
+        // Header and properties table rewritten, remaining data (font) copied verbatim
+        int fontDataSize = dataSize - propsDataSize;
+        buffer = (unsigned char *)RL_CALLOC(12 + patchedPropCount*8 + fontDataSize, 1);
+
+        memcpy(patchedProps, fileData, 8);
+        memcpy(patchedProps + 8, &patchedPropCount, sizeof(int));
+        memcpy(buffer, patchedProps, outOffset);
+        memcpy(buffer + outOffset, fileData + propsDataSize, fontDataSize);
+
+        *patchedDataSize = outOffset + fontDataSize;
+    }
+
+    RL_FREE(patchedProps);
+
+    return buffer;
+}
+
+// Export gui style as properties array
+// NOTE: Code file already implements a function to load style
+// GLOBAL: guiStyle, inFontFileName
+static void ExportStyleAsCode(const char *fileName, const char *styleName)
+{
+    // DEFAULT extended properties
+    static const char *guiPropsExtText[RAYGUI_MAX_PROPS_EXTENDED] = {
+        "TEXT_SIZE",
+        "TEXT_SPACING",
+        "LINE_COLOR",
+        "BACKGROUND_COLOR",
+        "TEXT_LINE_SPACING",
+        "TEXT_ALIGNMENT_VERTICAL",
+        "TEXT_WRAP_MODE",
+        "EXTENDED08",
+    };
+
+    FILE *txtFile = fopen(fileName, "wt");
+
+    if (txtFile != NULL)
+    {
+        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// StyleAsCode exporter v2.0 - Style data exported as a values array            //\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// USAGE: On init call: GuiLoadStyle%s();                                   //\n", TextToPascal(styleName));
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
+        fprintf(txtFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "// Copyright (c) 2020-2026 raylib technologies (@raylibtech)                    //\n");
+        fprintf(txtFile, "//                                                                              //\n");
+        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        char styleNameLower[64] = { 0 };
+        strcpy(styleNameLower, TextToLower(styleName));
+
+        if (codeStyleResolved)
+        {
+            // Export full style data array, properties resolved (DEFAULT properties already propagated)
+            // NOTE: One line per control: BASE properties followed by EXTENDED properties
+            fprintf(txtFile, "// Custom style name: %s\n", styleName);
+            fprintf(txtFile, "// NOTE: Full style data, loaded with GuiSetStyleData() (requires raygui 5.0)\n");
+            fprintf(txtFile, "static const unsigned int %sStyleData[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = {\n", styleNameLower);
+
+            for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+            {
+                fprintf(txtFile, "    ");
+                for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++) fprintf(txtFile, "0x%08x, ", GuiGetStyle(i, j));
+                fprintf(txtFile, "  // %s\n", guiControlText[i]);
+            }
+
+            fprintf(txtFile, "};\n\n");
+        }
+        else
+        {
+            // Export only properties that change from default style
+            // TODO: WARNING: This count is wrong!
+            fprintf(txtFile, "#define %s_STYLE_PROPS_COUNT  %i\n\n", TextToUpper(styleName), CountStyleChangesDefault());
+
+            // Write byte data as hexadecimal text
+            fprintf(txtFile, "// Custom style name: %s\n", styleName);
+            fprintf(txtFile, "static const GuiStyleProp %sStyleProps[%s_STYLE_PROPS_COUNT] = {\n", styleNameLower, TextToUpper(styleName));
+
+            // Write all properties that have changed in default (light) style
+            for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+            {
+                if (defaultStyle[i] != GuiGetStyle(0, i))
+                {
+                    if (i < RAYGUI_MAX_PROPS_BASE) fprintf(txtFile, "    { 0, %i, (int)0x%08x },    // DEFAULT_%s\n", i, GuiGetStyle(DEFAULT, i), guiProps[i].name);
+                    else fprintf(txtFile, "    { 0, %i, (int)0x%08x },    // DEFAULT_%s \n", i, GuiGetStyle(DEFAULT, i), guiPropsExtText[i - RAYGUI_MAX_PROPS_BASE]);
+                }
+            }
+
+            // Write all properties that have changed in comparison to default style
+            for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+            {
+                for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+                {
+                    // NOTE: Check Control property different than default (light) style
+                    if (GuiGetStyle(i, j) != defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j])
+                    {
+                        // Check property is different than its DEFAULT alternative ||
+                        // property different than default (light) style DEFAULT alternative
+                        if ((GuiGetStyle(i, j) != GuiGetStyle(0, j)) ||
+                            (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != defaultStyle[j]))
+                        {
+                            fprintf(txtFile, "    { %i, %i, (int)0x%08x },    // %s_%s\n", i, j, GuiGetStyle(i, j), guiControlText[i], guiProps[j].name);
+                        }
+                    }
+                }
+
+                // NOTE: Extended properties are not shared beetween controls, they are unique, even DEFAULT ones
+                for (int j = RAYGUI_MAX_PROPS_BASE; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+                {
+                    if (defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j))
+                    {
+                        fprintf(txtFile, "    { %i, %i, (int)0x%08x },    // %s_%s\n", i, j, GuiGetStyle(i, j), guiControlText[i], TextFormat("EXTENDED%02i", j - RAYGUI_MAX_PROPS_BASE + 1));
+                    }
+                }
+            }
+
+            fprintf(txtFile, "};\n\n");
+        }
+
+        if (customFontLoaded)
+        {
+            // NOTE: Font name is also updated in guiFontName on style loading
+            fprintf(txtFile, "// WARNING: This style uses a custom font: \"%s\" (size: %i, spacing: %i)\n\n",
+                    GetFileName(inFontFileName), GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
+        }
+
+        Image imFont = { 0 };
+        bool glyphsPacked = customFontLoaded && IsFontGlyphsDataPackable(customFont);   // Recs and glyphs data exported as 16-bit arrays
+
+        if (customFontLoaded)
+        {
+            // Support font export and initialization
+            // NOTE: This mechanism is highly coupled to raylib
+            imFont = LoadCustomFontAtlasImage();
+            if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) LOG("WARNING: Font image format is not GRAY+ALPHA!");
+
+            #define BYTES_TEXT_PER_LINE     20
+
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+            // NOTE: If data is compressed using raylib CompressData() DEFLATE,
+            // it requires to be decompressed with raylib DecompressData(), that requires
+            // compiling raylib with SUPPORT_COMPRESSION_API config flag enabled
+
+            // Font image data is usually GRAYSCALE + ALPHA
+
+            // Compress font image data
+            // NOTE: Compressed data is shared with other exporters (computed once per atlas)
+            int compDataSize = 0;
+            const unsigned char *compData = GetFontAtlasCompressedData(imFont, &compDataSize);
+
+            // Save font image data (compressed)
+            fprintf(txtFile, "#define %s_STYLE_FONT_ATLAS_COMP_SIZE %i\n\n", TextToUpper(styleName), compDataSize);
+            fprintf(txtFile, "// Font atlas image pixels data: DEFLATE compressed\n");
+            WriteStyleCodeData(txtFile, fileName, TextFormat("%sFontData", styleNameLower), TextFormat("%s_STYLE_FONT_ATLAS_COMP_SIZE", TextToUpper(styleName)), compData, compDataSize);
+#else
+            int imFontSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+
+            // Save font image data (uncompressed)
+            fprintf(txtFile, "// Font image pixels data\n");
+            WriteStyleCodeData(txtFile, fileName, TextFormat("%sFontImageData", styleNameLower), TextFormat("%i", imFontSize), (unsigned char *)imFont.data, imFontSize);
+#endif
+            if (glyphsPacked)
+            {
+                // NOTE: Glyphs data text built in memory and written at once, no printf() per value
+                // Packed data values are integers, same output as "%1.0f" for recs
+                TextBuffer text = { 0 };
+
+                // Save font recs data, packed 16-bit
+                TextBufferAppend(&text, "// Font glyphs rectangles data (on atlas): x, y, width, height\n", -1);
+                TextBufferAppend(&text, TextFormat("static const unsigned short %sFontRecs[%i][4] = {\n", styleNameLower, customFont.glyphCount), -1);
+                for (int i = 0; i < customFont.glyphCount; i++)
+                {
+                    TextBufferAppend(&text, "    { ", 6);
+                    TextBufferAppendInteger(&text, (int)customFont.recs[i].x);
+                    TextBufferAppend(&text, ", ", 2);
+                    TextBufferAppendInteger(&text, (int)customFont.recs[i].y);
+                    TextBufferAppend(&text, ", ", 2);
+                    TextBufferAppendInteger(&text, (int)customFont.recs[i].width);
+                    TextBufferAppend(&text, ", ", 2);
+                    TextBufferAppendInteger(&text, (int)customFont.recs[i].height);
+                    TextBufferAppend(&text, " },\n", 4);
+                }
+                TextBufferAppend(&text, "};\n\n", 4);
+
+                // Save font glyphs data, codepoints and 16-bit metrics
+                // NOTE: Individual glyphs image data not saved, it could be generated from atlas and recs
+                TextBufferAppend(&text, "// Font glyphs codepoints data\n", -1);
+                TextBufferAppend(&text, TextFormat("static const int %sFontCodepoints[%i] = { ", styleNameLower, customFont.glyphCount), -1);
+                for (int i = 0; i < customFont.glyphCount - 1; i++)
+                {
+                    TextBufferAppendInteger(&text, customFont.glyphs[i].value);
+                    if (i%BYTES_TEXT_PER_LINE == 0) TextBufferAppend(&text, ",\n    ", 6);
+                    else TextBufferAppend(&text, ", ", 2);
+                }
+                TextBufferAppendInteger(&text, customFont.glyphs[customFont.glyphCount - 1].value);
+                TextBufferAppend(&text, " };\n\n", 5);
+
+                TextBufferAppend(&text, "// Font glyphs info data: offsetX, offsetY, advanceX\n", -1);
+                TextBufferAppend(&text, "// NOTE: No glyphs.image data provided\n", -1);
+                TextBufferAppend(&text, TextFormat("static const short %sFontGlyphs[%i][3] = {\n", styleNameLower, customFont.glyphCount), -1);
+                for (int i = 0; i < customFont.glyphCount; i++)
+                {
+                    TextBufferAppend(&text, "    { ", 6);
+                    TextBufferAppendInteger(&text, customFont.glyphs[i].offsetX);
+                    TextBufferAppend(&text, ", ", 2);
+                    TextBufferAppendInteger(&text, customFont.glyphs[i].offsetY);
+                    TextBufferAppend(&text, ", ", 2);
+                    TextBufferAppendInteger(&text, customFont.glyphs[i].advanceX);
+                    TextBufferAppend(&text, " },\n", 4);
+                }
+                TextBufferAppend(&text, "};\n\n", 4);
+
+                fwrite(text.data, 1, text.length, txtFile);
+                RL_FREE(text.data);
+            }
+            else
+            {
+                // Save font recs data
+                fprintf(txtFile, "// Font glyphs rectangles data (on atlas)\n");
+                fprintf(txtFile, "static const Rectangle %sFontRecs[%i] = {\n", styleNameLower, customFont.glyphCount);
+                for (int i = 0; i < customFont.glyphCount; i++)
+                {
+                    fprintf(txtFile, "    { %1.0f, %1.0f, %1.0f , %1.0f },\n", customFont.recs[i].x, customFont.recs[i].y, customFont.recs[i].width, customFont.recs[i].height);
+                }
+                fprintf(txtFile, "};\n\n");
+
+                // Save font glyphs data
+                // NOTE: Individual glyphs image data not saved, it could be generated from atlas and recs
+                fprintf(txtFile, "// Font glyphs info data\n");
+                fprintf(txtFile, "// NOTE: No glyphs.image data provided\n");
+                fprintf(txtFile, "static const GlyphInfo %sFontGlyphs[%i] = {\n", styleNameLower, customFont.glyphCount);
+                for (int i = 0; i < customFont.glyphCount; i++)
+                {
+                    fprintf(txtFile, "    { %i, %i, %i, %i, { 0 }},\n", customFont.glyphs[i].value, customFont.glyphs[i].offsetX, customFont.glyphs[i].offsetY, customFont.glyphs[i].advanceX);
+                }
+                fprintf(txtFile, "};\n\n");
+            }
+
+            UnloadImage(imFont);
+        }
+
+        fprintf(txtFile, "// Style loading function: %s\n", styleName);
+        fprintf(txtFile, "static void GuiLoadStyle%s(void)\n{\n", TextToPascal(styleName));
+        if (codeStyleResolved)
+        {
+            fprintf(txtFile, "    // Load full style data provided\n");
+            fprintf(txtFile, "    // NOTE: Properties already resolved, only one copy required\n");
+            fprintf(txtFile, "    GuiSetStyleData(%sStyleData);\n\n", styleNameLower);
+        }
+        else
+        {
+            fprintf(txtFile, "    // Load style properties provided\n");
+            fprintf(txtFile, "    // NOTE: Default properties are propagated\n");
+            fprintf(txtFile, "    for (int i = 0; i < %s_STYLE_PROPS_COUNT; i++)\n    {\n", TextToUpper(styleName));
+            fprintf(txtFile, "        GuiSetStyle(%sStyleProps[i].controlId, %sStyleProps[i].propertyId, %sStyleProps[i].propertyValue);\n    }\n\n", styleNameLower, styleNameLower, styleNameLower);
+        }
 
         if (customFontLoaded)
         {
-            // Support font export and initialization
-            // NOTE: This mechanism is highly coupled to raylib
-            imFont = LoadImageFromTexture(customFont.texture);
-            if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) LOG("WARNING: Font image format is not GRAY+ALPHA!");
-            int imFontSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+            fprintf(txtFile, "    // Custom font loading\n");
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+            fprintf(txtFile, "    // NOTE: Compressed font image data (DEFLATE), it requires DecompressData() function\n");
+            fprintf(txtFile, "    int %sFontDataSize = 0;\n", styleNameLower);
+            fprintf(txtFile, "    unsigned char *data = DecompressData(%sFontData, %s_STYLE_FONT_ATLAS_COMP_SIZE, &%sFontDataSize);\n", styleNameLower, TextToUpper(styleName), styleNameLower);
+            fprintf(txtFile, "    Image imFont = { data, %i, %i, 1, %i };\n\n", imFont.width, imFont.height, imFont.format);
+            //fprintf(txtFile, "    ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+#else
+            fprintf(txtFile, "    Image imFont = { %sFontImageData, %i, %i, 1, %i };\n\n", styleNameLower, imFont.width, imFont.height, imFont.format);
+#endif
+            fprintf(txtFile, "    Font font = { 0 };\n");
+            fprintf(txtFile, "    font.baseSize = %i;\n", GuiGetStyle(DEFAULT, TEXT_SIZE));
+            fprintf(txtFile, "    font.glyphCount = %i;\n\n", customFont.glyphCount);
+
+            /*
+            // Assign global recs/glyphs data to loaded font
+            // NOTE: DO NOT DO THAT! GuiLoadStyleDefault() frees memory for styles loaded (other than default)
+            // it can be used to reset/free any previous loaded style to default before loading a new one
+            fprintf(txtFile, "    // Assign char recs data to global fontRecs\n");
+            fprintf(txtFile, "    // WARNING: Font char rec data can not be freed\n");
+            fprintf(txtFile, "    font.recs = %sFontRecs;\n\n", styleName);
+
+            fprintf(txtFile, "    // Assign font char info data to global fontChars\n");
+            fprintf(txtFile, "    // WARNING: Font char info data can not be freed\n");
+            fprintf(txtFile, "    font.glyphs = %sFontChars;\n\n", styleName);
+            */
+            if (glyphsPacked)
+            {
+                fprintf(txtFile, "    // Expand char recs and char info data from packed global data\n");
+                fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
+                fprintf(txtFile, "    font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));\n");
+                fprintf(txtFile, "    font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));\n\n");
+                fprintf(txtFile, "    for (int i = 0; i < font.glyphCount; i++)\n    {\n");
+                fprintf(txtFile, "        font.recs[i].x = %sFontRecs[i][0];\n", styleNameLower);
+                fprintf(txtFile, "        font.recs[i].y = %sFontRecs[i][1];\n", styleNameLower);
+                fprintf(txtFile, "        font.recs[i].width = %sFontRecs[i][2];\n", styleNameLower);
+                fprintf(txtFile, "        font.recs[i].height = %sFontRecs[i][3];\n\n", styleNameLower);
+                fprintf(txtFile, "        font.glyphs[i].value = %sFontCodepoints[i];\n", styleNameLower);
+                fprintf(txtFile, "        font.glyphs[i].offsetX = %sFontGlyphs[i][0];\n", styleNameLower);
+                fprintf(txtFile, "        font.glyphs[i].offsetY = %sFontGlyphs[i][1];\n", styleNameLower);
+                fprintf(txtFile, "        font.glyphs[i].advanceX = %sFontGlyphs[i][2];\n    }\n\n", styleNameLower);
+            }
+            else
+            {
+                fprintf(txtFile, "    // Copy char recs data from global fontRecs\n");
+                fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
+                fprintf(txtFile, "    font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));\n");
+                fprintf(txtFile, "    memcpy(font.recs, %sFontRecs, font.glyphCount*sizeof(Rectangle));\n\n", styleNameLower);
+
+                fprintf(txtFile, "    // Copy font char info data from global fontChars\n");
+                fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
+                fprintf(txtFile, "    font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));\n");
+                fprintf(txtFile, "    memcpy(font.glyphs, %sFontGlyphs, font.glyphCount*sizeof(GlyphInfo));\n\n", styleNameLower);
+            }
+
+            fprintf(txtFile, "    // Define font white rectangle to be used on shapes drawing\n");
+            fprintf(txtFile, "    // WARNING: It can be updated if icons are baked into font atlas image\n");
+            fprintf(txtFile, "    Rectangle fontWhiteRec = { %.0f, %.0f, %.0f, %.0f };\n\n", fontWhiteRec.x, fontWhiteRec.y, fontWhiteRec.width, fontWhiteRec.height);
+
+            // Bake icons into font atlas image, if required
+            fprintf(txtFile, "#if defined(RAYGUI_FONT_ICONS_BAKING)\n");
+            fprintf(txtFile, "     // Font atlas image icons baking\n");
+            fprintf(txtFile, "     Rectangle updatedWhiteRec = { 0 };\n");
+            fprintf(txtFile, "     guiIconFontOffsetY = GuiFontIconBaking(&imFont, font, &updatedWhiteRec);\n");
+            fprintf(txtFile, "     if (guiIconFontOffsetY > 0) fontWhiteRec = updatedWhiteRec;\n");
+            fprintf(txtFile, "#endif\n");
+
+            fprintf(txtFile, "    // Load texture from image\n");
+            fprintf(txtFile, "    font.texture = LoadTextureFromImage(imFont);\n");
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+            fprintf(txtFile, "    UnloadImage(imFont);  // Uncompressed image data can be unloaded from memory\n\n");
+#else
+            fprintf(txtFile, "    // WARNING: Uncompressed global image data can not be freed\n\n");
+#endif
+            fprintf(txtFile, "    GuiSetFont(font);\n\n");
+
+            if ((fontWhiteRec.x > 0) && (fontWhiteRec.y > 0) && (fontWhiteRec.width > 0) && (fontWhiteRec.height > 0))
+            {
+                fprintf(txtFile, "    // Setup a white rectangle on the font to be used on shapes drawing,\n");
+                fprintf(txtFile, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
+                fprintf(txtFile, "    SetShapesTexture(font.texture, fontWhiteRec);\n\n");
+            }
+            else
+            {
+                fprintf(txtFile, "    // TODO: Setup a white rectangle on the font to be used on shapes drawing,\n");
+                fprintf(txtFile, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
+                fprintf(txtFile, "    // NOTE: rGuiStyler provides a visual tool to define this rectangle on loaded font\n");
+                fprintf(txtFile, "    //Rectangle fontWhiteRec = { 0, 0, 0, 0 };\n");
+                fprintf(txtFile, "    //SetShapesTexture(font.texture, fontWhiteRec);\n\n");
+            }
+
+            fprintf(txtFile, "    // Set font name in raygui internal variable (requires raygui 5.0)\n");
+            fprintf(txtFile, "    snprintf(guiFontName, 32, \"%%s\", \"%s\");\n", GetFileName(inFontFileName));
+        }
+
+        fprintf(txtFile, "    //-----------------------------------------------------------------\n\n");
+        fprintf(txtFile, "    // TODO: Custom user style setup: Set specific properties here (if required)\n");
+        fprintf(txtFile, "    // i.e. Controls specific BORDER_WIDTH, TEXT_PADDING, TEXT_ALIGNMENT\n");
+
+        fprintf(txtFile, "}\n");
+
+        fclose(txtFile);
+    }
+}
+
+// Write style as code data array, using data emission mode (command line --code-data)
+// NOTE: Data text is built in memory and written at once, embed mode saves data to a companion
+// binary file (<fileName>.bin) next to code file, included with C23 #embed directive
+static void WriteStyleCodeData(FILE *file, const char *fileName, const char *dataName, const char *dataSizeText, const unsigned char *data, int dataSize)
+{
+    TextBuffer text = { 0 };
+
+    if (codeDataMode == CODE_DATA_EMBED)
+    {
+        char binFileName[512] = { 0 };
+        snprintf(binFileName, 512, "%s.bin", GetFileNameWithoutExt(fileName));
+
+        if (SaveFileData(TextFormat("%s/%s", GetDirectoryPath(fileName), binFileName), (void *)data, dataSize))
+        {
+            TextBufferAppend(&text, "// WARNING: Data included from binary file, it requires a C23 compiler with #embed support\n", -1);
+            TextBufferAppend(&text, TextFormat("static unsigned char %s[%s] = {\n", dataName, dataSizeText), -1);
+            TextBufferAppend(&text, "#if defined(__has_embed)\n", -1);
+            TextBufferAppend(&text, TextFormat("    #embed \"%s\"\n", binFileName), -1);
+            TextBufferAppend(&text, "#else\n", -1);
+            TextBufferAppend(&text, "    #error \"C23 #embed not supported, export style with: --code-data array\"\n", -1);
+            TextBufferAppend(&text, "#endif\n};\n\n", -1);
+        }
+        else
+        {
+            // NOTE: Binary file could not be saved, fallback to string literal
+            LOG("WARNING: Code data binary file could not be saved: %s\n", binFileName);
+            codeDataMode = CODE_DATA_STRING;
+            WriteStyleCodeData(file, fileName, dataName, dataSizeText, data, dataSize);
+            codeDataMode = CODE_DATA_EMBED;
+        }
+    }
+    else if (codeDataMode == CODE_DATA_STRING)
+    {
+        // NOTE: String literal requires an extra byte for the NULL terminator, not part of data
+        TextBufferAppend(&text, TextFormat("static unsigned char %s[%s + 1] =\n    \"", dataName, dataSizeText), -1);
+        TextBufferAppendBytesString(&text, data, dataSize);
+        TextBufferAppend(&text, "\";\n\n", 4);
+    }
+    else
+    {
+        TextBufferAppend(&text, TextFormat("static unsigned char %s[%s] = { ", dataName, dataSizeText), -1);
+        TextBufferAppendBytesArray(&text, data, dataSize);
+        TextBufferAppend(&text, " };\n\n", 5);
+    }
+
+    if (text.data != NULL) fwrite(text.data, 1, text.length, file);
+    RL_FREE(text.data);
+}
+
+// Load style file (text or binary) with font data CPU-side
+// NOTE: No GPU required (command line mode), font atlas is kept as an image (customFontAtlas),
+// style font is not set into raygui, customFont only provides font parameters, recs and glyphs
+static bool LoadStyleHeadless(const char *fileName)
+{
+    int fileDataSize = 0;
+
+    ProfileStageBegin(PROFILE_FILE_READ);
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
+    ProfileStageEnd(PROFILE_FILE_READ, fileDataSize);
+
+    bool result = LoadStyleHeadlessFromMemory(fileData, fileDataSize, GetDirectoryPath(fileName));
+
+    UnloadFileData(fileData);
+
+    return result;
+}
+
+// Load style from memory (text or binary) with font data CPU-side
+// NOTE: Text style font and charset files are loaded relative to provided base path
+// returns false if style data is not valid: binary style structure not valid, text style with no records
+// or style font (binary or referenced by text style) could not be loaded
+// GLOBAL: customFont, customFontAtlas, customFontLoaded, fontWhiteRec, inFontFileName, codepointList
+static bool LoadStyleHeadlessFromMemory(const unsigned char *fileData, int fileDataSize, const char *basePath)
+{
+    bool result = false;
+    bool fontProvided = false;          // Style provides a font, it must be loaded
+    char stylePath[512] = { 0 };        // NOTE: Base path copied, it could point to a TextFormat() static buffer
+    snprintf(stylePath, 512, "%s", (basePath != NULL)? basePath : ".");
+
+    UnloadStyleHeadless();
+
+    // Reset style to default before loading, avoids properties leaking between files
+    // NOTE: Default style backup (initialized on command line processing) is reused, no need to regenerate it
+    memcpy(guiStyle, defaultStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+    memset(guiFontName, 0, 32);
+
+    if ((fileData != NULL) && (fileDataSize > 12) &&
+        (fileData[0] == 'r') && (fileData[1] == 'G') && (fileData[2] == 'S') && (fileData[3] == ' '))
+    {
+        // Binary style file: properties loaded into guiStyle, font data returned CPU-side
+        // NOTE: File structure checked first, loader expects data inside bounds
+        if (IsStyleDataValid(fileData, fileDataSize, &fontProvided))
+        {
+            GuiLoadStyleFromMemoryEx(fileData, fileDataSize, &customFont, &customFontAtlas, &fontWhiteRec);
+            result = true;
+        }
+    }
+    else if ((fileData != NULL) && (fileDataSize > 0) && (fileData[0] == '#'))
+    {
+        // Text style file: properties and font file reference
+        // NOTE: Same parsing as GuiLoadStyle() but font atlas generated CPU-side (no LoadFontEx()),
+        // file data tokenized in place, no text copy required
+        const char *text = (const char *)fileData;
+        GuiStyleTextLine line = { 0 };
+        int version = 0;
+
+        // NOTE: Text parsing profiled as header parse, properties apply and font generation profiled as nested stages
+        ProfileStageBegin(PROFILE_HEADER_PARSE);
+
+        for (int pos = 0, lineSize = 0; pos < fileDataSize; pos += lineSize)
+        {
+            lineSize = GuiReadStyleTextLine(text + pos, fileDataSize - pos, &line);
+
+            switch (line.type)
+            {
+                case 'v':
+                {
+                    if (line.valueCount == 1)
+                    {
+                        version = line.values[0];
+                        result = true;
+                    }
+                } break;
+                case 'p':
+                {
+                    // Style property: p <control_id> <property_id> <property_value> <property_name>
+                    if (line.valueCount == 3)
+                    {
+                        ProfileStageBegin(PROFILE_PROPS_APPLY);
+                        GuiSetStyle(line.values[0], line.values[1], line.values[2]);
+                        ProfileStageEnd(PROFILE_PROPS_APPLY, 8);
+                        result = true;
+                    }
+                } break;
+                case 'f':
+                {
+                    // Style font: f <gen_font_size> <font_file> <charmap_file>
+                    // NOTE: Font and charmap files order changed on version 600
+                    if (line.valueCount < 1) break;
+
+                    fontProvided = true;
+                    result = true;
+
+                    int fontSize = line.values[0];
+                    char charmapFileName[256] = { 0 };
+                    char fontFileName[256] = { 0 };
+                    int fontToken = (version >= 600)? 0 : 1;
+
+                    snprintf(fontFileName, 256, "%.*s", line.tokensLength[fontToken], line.tokens[fontToken]);
+                    snprintf(charmapFileName, 256, "%.*s", line.tokensLength[1 - fontToken], line.tokens[1 - fontToken]);
+
+                    snprintf(guiFontName, 32, "%.31s", fontFileName);
+
+                    int *codepoints = NULL;
+                    int codepointCount = 0;
+
+                    if ((charmapFileName[0] != '\0') && (charmapFileName[0] != '0'))
+                    {
+                        // NOTE: Expected an UTF-8 array of codepoints, no separation
+                        char *charsetText = LoadFileText(TextFormat("%s/%s", stylePath, charmapFileName));
+                        if (charsetText != NULL) codepoints = LoadCodepoints(charsetText, &codepointCount);
+                        UnloadFileText(charsetText);
+                    }
+
+                    if (codepointCount == 0)
+                    {
+                        // Default to 95 standard codepoints
+                        UnloadCodepoints(codepoints);
+                        codepoints = LoadCodepoints(charsetBasic, &codepointCount);
+                    }
+
+                    int fontFileDataSize = 0;
+                    ProfileStageBegin(PROFILE_FILE_READ);
+                    unsigned char *fontFileData = (fontFileName[0] != '\0')? LoadFileData(TextFormat("%s/%s", stylePath, fontFileName), &fontFileDataSize) : NULL;
+                    ProfileStageEnd(PROFILE_FILE_READ, fontFileDataSize);
+
+                    if (fontFileData != NULL)
+                    {
+                        ProfileStageBegin(PROFILE_FONT_GENERATION);
+
+                        // Generate font atlas CPU-side, same parameters used by LoadFontEx()
+                        // NOTE: raylib 6.0 LoadFontData() also returns loaded glyphs count
+                        int glyphCount = codepointCount;
+#if (RAYLIB_VERSION_MAJOR >= 6)
+                        customFont.glyphs = LoadFontData(fontFileData, fontFileDataSize, fontSize, codepoints, codepointCount, FONT_DEFAULT, &glyphCount);
+#else
+                        customFont.glyphs = LoadFontData(fontFileData, fontFileDataSize, fontSize, codepoints, codepointCount, FONT_DEFAULT);
+#endif
+                        if (customFont.glyphs != NULL)
+                        {
+                            customFont.baseSize = fontSize;
+                            customFont.glyphCount = glyphCount;
+                            customFont.glyphPadding = 4;
+                            customFontAtlas = GenImageFontAtlas(customFont.glyphs, &customFont.recs, customFont.glyphCount, fontSize, customFont.glyphPadding, 0);
+
+                            // Glyphs images not required once atlas is generated
+                            for (int i = 0; i < customFont.glyphCount; i++)
+                            {
+                                UnloadImage(customFont.glyphs[i].image);
+                                customFont.glyphs[i].image = (Image){ 0 };
+                            }
+
+                            // NOTE: GenImageFontAtlas() adds a white rectangle at the bottom-right corner of the atlas
+                            fontWhiteRec = (Rectangle){ (float)customFontAtlas.width - 2, (float)customFontAtlas.height - 2, 1, 1 };
+                        }
+                        ProfileStageEnd(PROFILE_FONT_GENERATION, (customFontAtlas.data != NULL)? GetPixelDataSize(customFontAtlas.width, customFontAtlas.height, customFontAtlas.format) : 0);
+
+                        UnloadFileData(fontFileData);
+                    }
+
+                    UnloadCodepoints(codepoints);
+
+                    // If font not properly loaded, revert to default font size/spacing (same as GuiLoadStyle())
+                    if (customFontAtlas.data == NULL)
+                    {
+                        UnloadStyleHeadless();
+                        GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
+                        GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
+                    }
+                } break;
+                default: break;
+            }
+        }
+
+        ProfileStageEnd(PROFILE_HEADER_PARSE, fileDataSize);
+    }
+
+    customFontLoaded = (customFontAtlas.data != NULL) && (customFont.glyphCount > 0);
+
+    // Style font provided but not loaded (corrupted data or font file not found)
+    if (fontProvided && !customFontLoaded) result = false;
+
+    if (customFontLoaded)
+    {
+        // Keep font file name for export, embedded in binary style (version >= 600) or referenced by text style
+        if ((guiFontName[0] != '\0') && (guiFontName[0] != '<')) snprintf(inFontFileName, 512, "%s", guiFontName);
+
+        // Font codepoints required for text style charset export
+        // WARNING: codepointList and codepointListCount are global variables in gui_window_font_atlas module
+        codepointList = (int *)RL_CALLOC(customFont.glyphCount, sizeof(int));
+        codepointListCount = customFont.glyphCount;
+        for (int i = 0; i < customFont.glyphCount; i++) codepointList[i] = customFont.glyphs[i].value;
+    }
+
+    return result;
+}
+
+// Check binary style data structure is valid, any version (v200-v700)
+// NOTE: Data is not decoded, only header, properties and font data (or sections) are checked to be
+// inside data bounds, font atlas size is checked against atlas image size (v700),
+// fontProvided returns if style data includes a font
+static bool IsStyleDataValid(const unsigned char *fileData, int dataSize, bool *fontProvided)
+{
+    bool result = false;
+    short version = 0;
+    int count = 0;          // Properties count (v200-v600) or sections count (v700)
+
+    *fontProvided = false;
+
+    if ((fileData == NULL) || (dataSize < 12) || (memcmp(fileData, "rGS ", 4) != 0)) return false;
+
+    memcpy(&version, fileData + 4, sizeof(short));
+    memcpy(&count, fileData + 8, sizeof(int));
+
+    if (version >= 700)
+    {
+        // Sections directory and all sections data must be inside file data, properties section required
+        if ((count > 0) && (count <= (dataSize - 12)/20))
+        {
+            result = true;
+
+            for (int i = 0; (i < count) && result; i++)
+            {
+                const unsigned char *entry = fileData + 12 + i*20;
+                int offset = 0;
+                int size = 0;
+                memcpy(&offset, entry + 8, sizeof(int));
+                memcpy(&size, entry + 12, sizeof(int));
+
+                if ((offset < 12) || (size < 0) || (offset > dataSize) || (size > (dataSize - offset))) result = false;
+                if (memcmp(entry, "FONT", 4) == 0) *fontProvided = true;
+            }
+
+            if (result) result = (GuiGetStyleSection(fileData, dataSize, "PROP").data != NULL) ||
+                                 (GuiGetStyleSection(fileData, dataSize, "PRPC").data != NULL);
+
+            // Font atlas data size must match font atlas image size (GRAY+ALPHA or reduced bit-depth alpha)
+            GuiStyleSection fontSection = GuiGetStyleSection(fileData, dataSize, "FONT");
+            GuiStyleSection atlasSection = GuiGetStyleSection(fileData, dataSize, "ATLS");
+
+            if (result && (fontSection.data != NULL))
+            {
+                int imParams[4] = { 0, 0, 0, 16 };  // Atlas image params: width, height, format, bpp
+
+                if ((fontSection.codec != STYLE_CODEC_NONE) || (fontSection.size < 72) || (atlasSection.data == NULL)) result = false;
+                else
+                {
+                    memcpy(imParams, fontSection.data + 32 + 12 + 16, 3*sizeof(int));
+                    if (fontSection.size >= 76) memcpy(&imParams[3], fontSection.data + 32 + 12 + 16 + 12, sizeof(int));
+
+                    long long pixelCount = (long long)imParams[0]*imParams[1];
+                    long long atlasDataSize = (atlasSection.codec == STYLE_CODEC_NONE)? atlasSection.size : atlasSection.dataSize;
+                    long long atlasRequiredSize = 0;
+
+                    if (imParams[3] == 16) atlasRequiredSize = pixelCount*2;
+                    else if (imParams[3] == 8) atlasRequiredSize = pixelCount;
+                    else if ((imParams[3] == 4) || (imParams[3] == 1)) atlasRequiredSize = (1 << imParams[3]) + (pixelCount*imParams[3] + 7)/8;
+
+                    if ((imParams[0] <= 0) || (imParams[1] <= 0) || (imParams[2] != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                        (pixelCount > (0x7fffffff/2)) || (atlasRequiredSize <= 0) || (atlasDataSize < atlasRequiredSize)) result = false;
+                }
+            }
+        }
+    }
+    else if ((version > 0) && (count >= 0) && (count <= (dataSize - 16)/8))
+    {
+        // Legacy versions: properties and font data sizes must be inside file data
+        // NOTE: Same structure walk as UpgradeStyleFromMemory()
+        int offset = 12 + count*8;
+        int fontDataSize = 0;
+        memcpy(&fontDataSize, fileData + offset, sizeof(int));
+        offset += 4;
+
+        result = (fontDataSize >= 0);
+
+        if (fontDataSize > 0)
+        {
+            int glyphCount = 0;
+            int imDataSize[2] = { 0 };      // Image data size: uncompressed, compressed
+
+            *fontProvided = true;
+
+            // Font parameters: file name (32 bytes, VERSION: >=600), font params and image params (48 bytes)
+            if (version >= 600) offset += 32;
+            if ((offset + 48) > dataSize) return false;
+
+            memcpy(&glyphCount, fileData + offset + 4, sizeof(int));
+            memcpy(imDataSize, fileData + offset + 28, 2*sizeof(int));
+            offset += 48;
+
+            int atlasDataSize = ((imDataSize[1] > 0) && (imDataSize[1] != imDataSize[0]))? imDataSize[1] : imDataSize[0];
+            if ((glyphCount <= 0) || (glyphCount > (0x7fffffff/16)) || (atlasDataSize <= 0) || (atlasDataSize > (dataSize - offset))) return false;
+            offset += atlasDataSize;
+
+            // Font recs and glyphs data (16 bytes per glyph each one)
+            // NOTE: Version 400 adds the compression size parameter (0 - not compressed)
+            for (int section = 0; (section < 2) && result; section++)
+            {
+                int sectionCompSize = 0;
+
+                if (version >= 400)
+                {
+                    if ((offset + 4) > dataSize) return false;
+                    memcpy(&sectionCompSize, fileData + offset, sizeof(int));
+                    offset += 4;
+                }
+
+                int sectionDataSize = ((sectionCompSize > 0) && (sectionCompSize != glyphCount*16))? sectionCompSize : glyphCount*16;
+                if ((sectionDataSize < 0) || (sectionDataSize > (dataSize - offset))) result = false;
+                offset += sectionDataSize;
+            }
+        }
+    }
+
+    return result;
+}
+
+// Unload style font data loaded CPU-side
+static void UnloadStyleHeadless(void)
+{
+    if (customFontAtlas.data != NULL) UnloadImage(customFontAtlas);
+    customFontAtlas = (Image){ 0 };
+
+    if (customFont.texture.id == 0)
+    {
+        // NOTE: Font data loaded CPU-side, no texture to unload
+        RL_FREE(customFont.recs);
+        RL_FREE(customFont.glyphs);
+        customFont = (Font){ 0 };
+    }
+
+    RL_FREE(codepointList);
+    codepointList = NULL;
+    codepointListCount = 0;
+
+    customFontLoaded = false;
+    fontWhiteRec = (Rectangle){ 0 };
+    memset(inFontFileName, 0, 512);
+}
+
+// Load style template (embedded code) into guiStyle, including font
+// NOTE: Default style is loaded first, required to unload any previously loaded font texture,
+// templates font atlas is uploaded to GPU (window required)
+static void LoadStyleTemplate(int index)
+{
+    // Reset to default internal style
+    GuiLoadStyleDefault();
+
+    // Load style into guiStyle
+    switch (index)
+    {
+        case 1: GuiLoadStyleJungle(); break;
+        case 2: GuiLoadStyleCandy(); break;
+        case 3: GuiLoadStyleLavanda(); break;
+        case 4: GuiLoadStyleCyber(); break;
+        case 5: GuiLoadStyleTerminal(); break;
+        case 6: GuiLoadStyleAshes(); break;
+        case 7: GuiLoadStyleBluish(); break;
+        case 8: GuiLoadStyleDark(); break;
+        case 9: GuiLoadStyleCherry(); break;
+        case 10: GuiLoadStyleSunny(); break;
+        case 11: GuiLoadStyleEnefete(); break;
+        case 12: GuiLoadStyleAmber(); break;
+        case 13: GuiLoadStyleRLTech(); break;
+        case 14: GuiLoadStyleGenesis(); break;
+        case 15: GuiLoadStyleWisteria(); break;
+        case 16: GuiLoadStylePocket(); break;
+        case 17: GuiLoadStyleBrick(); break;
+        case 18: GuiLoadStyleAdvance(); break;
+        case 19: GuiLoadStyleTurbo(); break;
+        default: break;
+    }
+}
+
+// Load style template font texture (called by templates loading code)
+// NOTE: On templates headless loading, font atlas image is kept CPU-side (customFontAtlas), no texture loaded
+static Texture2D LoadStyleTemplateTexture(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if (styleTemplateHeadless)
+    {
+        UnloadImage(customFontAtlas);
+        customFontAtlas = ImageCopy(image);     // NOTE: Template image data is unloaded after texture loading
+    }
+    else texture = LoadTextureFromImage(image);
+
+    return texture;
+}
+
+// Set style template font (called by templates loading code)
+// NOTE: On templates headless loading, font recs and glyphs are kept by customFont (freed by UnloadStyleHeadless())
+static void SetStyleTemplateFont(Font font)
+{
+    if (styleTemplateHeadless)
+    {
+        RL_FREE(customFont.recs);
+        RL_FREE(customFont.glyphs);
+        customFont = font;
+    }
+    else GuiSetFont(font);
+}
+
+// Set style template shapes texture (called by templates loading code)
+// NOTE: On templates headless loading, only font white rectangle is kept (fontWhiteRec)
+static void SetStyleTemplateShapesTexture(Texture2D texture, Rectangle source)
+{
+    if (styleTemplateHeadless) fontWhiteRec = source;
+    else SetShapesTexture(texture, source);
+}
+
+// Load custom font atlas image
+// NOTE: CPU-side atlas copy is used if available, avoids texture readback (GPU required)
+static Image LoadCustomFontAtlasImage(void)
+{
+    Image atlas = { 0 };
+
+    if (customFontAtlas.data != NULL) atlas = ImageCopy(customFontAtlas);
+    else atlas = LoadImageFromTexture(customFont.texture);
+
+    return atlas;
+}
+
+// Get font atlas compressed data (DEFLATE)
+// NOTE: Compressed data is kept and reused while atlas data does not change (checked by data hash),
+// avoids compressing same atlas multiple times when exporting multiple formats, data must not be freed
+static const unsigned char *GetFontAtlasCompressedData(Image atlas, int *compDataSize)
+{
+    int dataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+    unsigned long long hash = GuiComputeDataHash((const unsigned char *)atlas.data, dataSize, 0);
+
+    // Hash also considers image size and format, same pixel data could be interpreted differently
+    int params[3] = { atlas.width, atlas.height, atlas.format };
+    hash = GuiComputeDataHash((const unsigned char *)params, sizeof(params), hash);
+
+    if ((fontAtlasCompData == NULL) || (hash != fontAtlasCompDataHash))
+    {
+        MemFree(fontAtlasCompData);
+        ProfileStageBegin(PROFILE_DEFLATE);
+        fontAtlasCompData = CompressData((const unsigned char *)atlas.data, dataSize, &fontAtlasCompDataSize);
+        ProfileStageEnd(PROFILE_DEFLATE, dataSize);
+        fontAtlasCompDataHash = hash;
+    }
+
+    *compDataSize = fontAtlasCompDataSize;
+
+    return fontAtlasCompData;
+}
+
+// Encode font atlas image data with reduced bit-depth (alpha only), if lossless
+// NOTE: Atlas gray channel must be white (font atlas default), 1 and 4 bpp data is indexed:
+// alpha palette (2 or 16 bytes) followed by packed indices (MSB first), returns NULL if not possible,
+// bpp and dataSize are always set (16 bpp for GRAY+ALPHA data)
+static unsigned char *EncodeFontAtlasData(Image atlas, int *bpp, int *dataSize)
+{
+    const unsigned char *pixels = (const unsigned char *)atlas.data;
+    int pixelCount = atlas.width*atlas.height;
+
+    *bpp = 16;
+    *dataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+    if ((pixels == NULL) || (atlas.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)) return NULL;
+
+    // Check gray channel and alpha values used
+    bool alphaUsed[256] = { 0 };
+    for (int i = 0; i < pixelCount; i++)
+    {
+        if (pixels[2*i] != 255) return NULL;
+        alphaUsed[pixels[2*i + 1]] = true;
+    }
+
+    unsigned char palette[16] = { 0 };
+    unsigned char paletteIndex[256] = { 0 };
+    int alphaCount = 0;
+
+    for (int i = 0; i < 256; i++)
+    {
+        if (!alphaUsed[i]) continue;
+
+        if (alphaCount < 16)
+        {
+            palette[alphaCount] = (unsigned char)i;
+            paletteIndex[i] = (unsigned char)alphaCount;
+        }
+
+        alphaCount++;
+    }
+
+    *bpp = (alphaCount <= 2)? 1 : ((alphaCount <= 16)? 4 : 8);
+
+    int paletteSize = (*bpp < 8)? (1 << *bpp) : 0;
+    *dataSize = paletteSize + (pixelCount*(*bpp) + 7)/8;
+
+    unsigned char *data = (unsigned char *)RL_CALLOC(*dataSize, 1);
+
+    if (*bpp == 8) for (int i = 0; i < pixelCount; i++) data[i] = pixels[2*i + 1];
+    else
+    {
+        memcpy(data, palette, paletteSize);
+
+        for (int i = 0; i < pixelCount; i++)
+        {
+            int bit = i*(*bpp);
+            data[paletteSize + bit/8] |= (paletteIndex[pixels[2*i + 1]] << (8 - *bpp - bit%8));
+        }
+    }
+
+    return data;
+}
+
+// Check font recs and glyphs data fit 16-bit packed sections
+// NOTE: Recs must be integer values in atlas range [0..65535], glyphs metrics in short range
+static bool IsFontGlyphsDataPackable(Font font)
+{
+    if ((font.recs == NULL) || (font.glyphs == NULL) || (font.glyphCount <= 0)) return false;
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        float rec[4] = { font.recs[i].x, font.recs[i].y, font.recs[i].width, font.recs[i].height };
+        int metrics[3] = { font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX };
+
+        for (int k = 0; k < 4; k++) if ((rec[k] < 0.0f) || (rec[k] > 65535.0f) || (rec[k] != (float)(int)rec[k])) return false;
+        for (int k = 0; k < 3; k++) if ((metrics[k] < -32768) || (metrics[k] > 32767)) return false;
+    }
+
+    return true;
+}
+
+// Compress style section data with codec (DEFLATE, LZ4)
+// NOTE: Returned data must be freed (MemFree)
+static unsigned char *CompressSectionData(const unsigned char *data, int dataSize, int codec, int *compDataSize)
+{
+    unsigned char *compData = NULL;
 
-            #define BYTES_TEXT_PER_LINE     20
+    // NOTE: Every codec is profiled as a different stage, to compare codecs compression time
+    int stage = (codec == STYLE_CODEC_LZ4)? PROFILE_LZ4 : PROFILE_DEFLATE;
 
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-            // NOTE: If data is compressed using raylib CompressData() DEFLATE,
-            // it requires to be decompressed with raylib DecompressData(), that requires
-            // compiling raylib with SUPPORT_COMPRESSION_API config flag enabled
+    ProfileStageBegin(stage);
+    if (codec == STYLE_CODEC_LZ4) compData = CompressDataLZ4(data, dataSize, compDataSize);
+    else compData = CompressData(data, dataSize, compDataSize);
+    ProfileStageEnd(stage, dataSize);
 
-            // Font image data is usually GRAYSCALE + ALPHA
+    return compData;
+}
 
-            // Compress font image data
-            int compDataSize = 0;
-            unsigned char *compData = CompressData(imFont.data, imFontSize, &compDataSize);
+// Compress data (LZ4 block format)
+// NOTE: Greedy matching with a single hash table, decompression is several times faster than DEFLATE,
+// data can be decompressed by raygui or any LZ4 block decoder (original data size required)
+static unsigned char *CompressDataLZ4(const unsigned char *data, int dataSize, int *compDataSize)
+{
+    #define LZ4_HASH_BITS           12      // Hash table size: 4096 entries
+    #define LZ4_MIN_MATCH            4      // Minimum match length
+    #define LZ4_LAST_LITERALS        5      // Last bytes always stored as literals
+    #define LZ4_MATCH_LIMIT         12      // Last match must start at least 12 bytes before data end
+    #define LZ4_MAX_OFFSET       65535      // Max match distance
 
-            // Save font image data (compressed)
-            fprintf(txtFile, "#define %s_STYLE_FONT_ATLAS_COMP_SIZE %i\n\n", TextToUpper(styleName), compDataSize);
-            fprintf(txtFile, "// Font atlas image pixels data: DEFLATE compressed\n");
-            fprintf(txtFile, "static unsigned char %sFontData[%s_STYLE_FONT_ATLAS_COMP_SIZE] = { ", styleNameLower, TextToUpper(styleName));
-            for (int i = 0; i < compDataSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%02x,\n    " : "0x%02x, "), compData[i]);
-            fprintf(txtFile, "0x%02x };\n\n", compData[compDataSize - 1]);
-            MemFree(compData);
-#else
-            // Save font image data (uncompressed)
-            fprintf(txtFile, "// Font image pixels data\n");
-            fprintf(txtFile, "static unsigned char %sFontImageData[%i] = { ", styleNameLower, imFontSize);
-            for (int i = 0; i < imFontSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%02x,\n    " : "0x%02x, "), ((unsigned char *)imFont.data)[i]);
-            fprintf(txtFile, "0x%02x };\n\n", ((unsigned char *)imFont.data)[imFontSize - 1]);
-#endif
-            // Save font recs data
-            fprintf(txtFile, "// Font glyphs rectangles data (on atlas)\n");
-            fprintf(txtFile, "static const Rectangle %sFontRecs[%i] = {\n", styleNameLower, customFont.glyphCount);
-            for (int i = 0; i < customFont.glyphCount; i++)
-            {
-                fprintf(txtFile, "    { %1.0f, %1.0f, %1.0f , %1.0f },\n", customFont.recs[i].x, customFont.recs[i].y, customFont.recs[i].width, customFont.recs[i].height);
-            }
-            fprintf(txtFile, "};\n\n");
+    // NOTE: Worst case size for incompressible data: literals plus length bytes
+    unsigned char *compData = (unsigned char *)RL_CALLOC(dataSize + dataSize/255 + 16, 1);
+    int *hashTable = (int *)RL_CALLOC(1 << LZ4_HASH_BITS, sizeof(int));     // Positions + 1 (0 - empty)
 
-            // Save font glyphs data
-            // NOTE: Individual glyphs image data not saved, it could be generated from atlas and recs
-            fprintf(txtFile, "// Font glyphs info data\n");
-            fprintf(txtFile, "// NOTE: No glyphs.image data provided\n");
-            fprintf(txtFile, "static const GlyphInfo %sFontGlyphs[%i] = {\n", styleNameLower, customFont.glyphCount);
-            for (int i = 0; i < customFont.glyphCount; i++)
-            {
-                fprintf(txtFile, "    { %i, %i, %i, %i, { 0 }},\n", customFont.glyphs[i].value, customFont.glyphs[i].offsetX, customFont.glyphs[i].offsetY, customFont.glyphs[i].advanceX);
-            }
-            fprintf(txtFile, "};\n\n");
+    int position = 0;
+    int anchor = 0;         // First literal not written yet
+    int outOffset = 0;
 
-            UnloadImage(imFont);
+    while ((position + LZ4_MATCH_LIMIT) <= dataSize)
+    {
+        unsigned int sequence = 0;
+        memcpy(&sequence, data + position, 4);
+
+        unsigned int hash = (sequence*2654435761u) >> (32 - LZ4_HASH_BITS);
+        int candidate = hashTable[hash] - 1;
+        hashTable[hash] = position + 1;
+
+        if ((candidate < 0) || ((position - candidate) > LZ4_MAX_OFFSET) || (memcmp(data + candidate, data + position, LZ4_MIN_MATCH) != 0))
+        {
+            position++;
+            continue;
         }
 
-        fprintf(txtFile, "// Style loading function: %s\n", styleName);
-        fprintf(txtFile, "static void GuiLoadStyle%s(void)\n{\n", TextToPascal(styleName));
-        fprintf(txtFile, "    // Load style properties provided\n");
-        fprintf(txtFile, "    // NOTE: Default properties are propagated\n");
-        fprintf(txtFile, "    for (int i = 0; i < %s_STYLE_PROPS_COUNT; i++)\n    {\n", TextToUpper(styleName));
-        fprintf(txtFile, "        GuiSetStyle(%sStyleProps[i].controlId, %sStyleProps[i].propertyId, %sStyleProps[i].propertyValue);\n    }\n\n", styleNameLower, styleNameLower, styleNameLower);
+        int matchLength = LZ4_MIN_MATCH;
+        while (((position + matchLength) < (dataSize - LZ4_LAST_LITERALS)) && (data[candidate + matchLength] == data[position + matchLength])) matchLength++;
 
-        if (customFontLoaded)
+        // Write sequence: token, literals length, literals, match offset, match length
+        int literalsLength = position - anchor;
+        int offset = position - candidate;
+
+        compData[outOffset++] = (unsigned char)((((literalsLength < 15)? literalsLength : 15) << 4) | (((matchLength - LZ4_MIN_MATCH) < 15)? (matchLength - LZ4_MIN_MATCH) : 15));
+
+        if (literalsLength >= 15)
         {
-            fprintf(txtFile, "    // Custom font loading\n");
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-            fprintf(txtFile, "    // NOTE: Compressed font image data (DEFLATE), it requires DecompressData() function\n");
-            fprintf(txtFile, "    int %sFontDataSize = 0;\n", styleNameLower);
-            fprintf(txtFile, "    unsigned char *data = DecompressData(%sFontData, %s_STYLE_FONT_ATLAS_COMP_SIZE, &%sFontDataSize);\n", styleNameLower, TextToUpper(styleName), styleNameLower);
-            fprintf(txtFile, "    Image imFont = { data, %i, %i, 1, %i };\n\n", imFont.width, imFont.height, imFont.format);
-            //fprintf(txtFile, "    ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
-#else
-            fprintf(txtFile, "    Image imFont = { %sFontImageData, %i, %i, 1, %i };\n\n", styleNameLower, imFont.width, imFont.height, imFont.format);
-#endif
-            fprintf(txtFile, "    Font font = { 0 };\n");
-            fprintf(txtFile, "    font.baseSize = %i;\n", GuiGetStyle(DEFAULT, TEXT_SIZE));
-            fprintf(txtFile, "    font.glyphCount = %i;\n\n", customFont.glyphCount);
+            int length = literalsLength - 15;
+            for (; length >= 255; length -= 255) compData[outOffset++] = 255;
+            compData[outOffset++] = (unsigned char)length;
+        }
 
-            /*
-            // Assign global recs/glyphs data to loaded font
-            // NOTE: DO NOT DO THAT! GuiLoadStyleDefault() frees memory for styles loaded (other than default)
-            // it can be used to reset/free any previous loaded style to default before loading a new one
-            fprintf(txtFile, "    // Assign char recs data to global fontRecs\n");
-            fprintf(txtFile, "    // WARNING: Font char rec data can not be freed\n");
-            fprintf(txtFile, "    font.recs = %sFontRecs;\n\n", styleName);
+        memcpy(compData + outOffset, data + anchor, literalsLength);
+        outOffset += literalsLength;
 
-            fprintf(txtFile, "    // Assign font char info data to global fontChars\n");
-            fprintf(txtFile, "    // WARNING: Font char info data can not be freed\n");
-            fprintf(txtFile, "    font.glyphs = %sFontChars;\n\n", styleName);
-            */
-            fprintf(txtFile, "    // Copy char recs data from global fontRecs\n");
-            fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
-            fprintf(txtFile, "    font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));\n");
-            fprintf(txtFile, "    memcpy(font.recs, %sFontRecs, font.glyphCount*sizeof(Rectangle));\n\n", styleNameLower);
+        compData[outOffset++] = (unsigned char)(offset & 0xff);
+        compData[outOffset++] = (unsigned char)(offset >> 8);
 
-            fprintf(txtFile, "    // Copy font char info data from global fontChars\n");
-            fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
-            fprintf(txtFile, "    font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));\n");
-            fprintf(txtFile, "    memcpy(font.glyphs, %sFontGlyphs, font.glyphCount*sizeof(GlyphInfo));\n\n", styleNameLower);
+        if ((matchLength - LZ4_MIN_MATCH) >= 15)
+        {
+            int length = matchLength - LZ4_MIN_MATCH - 15;
+            for (; length >= 255; length -= 255) compData[outOffset++] = 255;
+            compData[outOffset++] = (unsigned char)length;
+        }
 
-            fprintf(txtFile, "    // Define font white rectangle to be used on shapes drawing\n");
-            fprintf(txtFile, "    // WARNING: It can be updated if icons are baked into font atlas image\n");
-            fprintf(txtFile, "    Rectangle fontWhiteRec = { %.0f, %.0f, %.0f, %.0f };\n\n", fontWhiteRec.x, fontWhiteRec.y, fontWhiteRec.width, fontWhiteRec.height);
+        position += matchLength;
+        anchor = position;
+    }
 
-            // Bake icons into font atlas image, if required
-            fprintf(txtFile, "#if defined(RAYGUI_FONT_ICONS_BAKING)\n");
-            fprintf(txtFile, "     // Font atlas image icons baking\n");
-            fprintf(txtFile, "     Rectangle updatedWhiteRec = { 0 };\n");
-            fprintf(txtFile, "     guiIconFontOffsetY = GuiFontIconBaking(&imFont, font, &updatedWhiteRec);\n");
-            fprintf(txtFile, "     if (guiIconFontOffsetY > 0) fontWhiteRec = updatedWhiteRec;\n");
-            fprintf(txtFile, "#endif\n");
+    // Write last sequence, only literals (no match)
+    int literalsLength = dataSize - anchor;
+    compData[outOffset++] = (unsigned char)(((literalsLength < 15)? literalsLength : 15) << 4);
 
-            fprintf(txtFile, "    // Load texture from image\n");
-            fprintf(txtFile, "    font.texture = LoadTextureFromImage(imFont);\n");
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-            fprintf(txtFile, "    UnloadImage(imFont);  // Uncompressed image data can be unloaded from memory\n\n");
-#else
-            fprintf(txtFile, "    // WARNING: Uncompressed global image data can not be freed\n\n");
-#endif
-            fprintf(txtFile, "    GuiSetFont(font);\n\n");
+    if (literalsLength >= 15)
+    {
+        int length = literalsLength - 15;
+        for (; length >= 255; length -= 255) compData[outOffset++] = 255;
+        compData[outOffset++] = (unsigned char)length;
+    }
 
-            if ((fontWhiteRec.x > 0) && (fontWhiteRec.y > 0) && (fontWhiteRec.width > 0) && (fontWhiteRec.height > 0))
-            {
-                fprintf(txtFile, "    // Setup a white rectangle on the font to be used on shapes drawing,\n");
-                fprintf(txtFile, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
-                fprintf(txtFile, "    SetShapesTexture(font.texture, fontWhiteRec);\n\n");
-            }
-            else
-            {
-                fprintf(txtFile, "    // TODO: Setup a white rectangle on the font to be used on shapes drawing,\n");
-                fprintf(txtFile, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
-                fprintf(txtFile, "    // NOTE: rGuiStyler provides a visual tool to define this rectangle on loaded font\n");
-                fprintf(txtFile, "    //Rectangle fontWhiteRec = { 0, 0, 0, 0 };\n");
-                fprintf(txtFile, "    //SetShapesTexture(font.texture, fontWhiteRec);\n\n");
-            }
+    memcpy(compData + outOffset, data + anchor, literalsLength);
+    outOffset += literalsLength;
 
-            fprintf(txtFile, "    // Set font name in raygui internal variable (requires raygui 5.0)\n");
-            fprintf(txtFile, "    snprintf(guiFontName, 32, \"%%s\", \"%s\");\n", GetFileName(inFontFileName));
-        }
+    RL_FREE(hashTable);
 
-        fprintf(txtFile, "    //-----------------------------------------------------------------\n\n");
-        fprintf(txtFile, "    // TODO: Custom user style setup: Set specific properties here (if required)\n");
-        fprintf(txtFile, "    // i.e. Controls specific BORDER_WIDTH, TEXT_PADDING, TEXT_ALIGNMENT\n");
+    *compDataSize = outOffset;
 
-        fprintf(txtFile, "}\n");
+    return compData;
+}
 
-        fclose(txtFile);
+// Get style file extension for export format
+static const char *GetStyleFileExtension(int format)
+{
+    const char *extension = "";
+
+    switch (format)
+    {
+        case STYLE_BINARY: extension = ".rgs"; break;
+        case STYLE_AS_CODE: extension = ".h"; break;
+        case STYLE_TABLE_IMAGE: extension = ".png"; break;
+        case STYLE_TEXT: extension = ".rgs.txt"; break;
+        default: break;
     }
+
+    return extension;
 }
 
 // Draw style controls table
@@ -3356,3 +6508,358 @@ static void BuildControlPropsText(int currentSelectedControl)
         default: break;
     }
 }
+
+// Get monotonic time stamp in seconds
+// NOTE: raylib GetTime() requires an initialized window, not available on command line mode
+static double GetTimeStamp(void)
+{
+    double time = 0.0;
+
+#if defined(_WIN32)
+    time = (double)clock()/CLOCKS_PER_SEC;      // NOTE: clock() measures wall time on Windows
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    time = (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+
+    return time;
+}
+
+// Check file name matches wildcard pattern
+// NOTE: Supported wildcards: '*' (any characters sequence), '?' (any single character)
+static bool IsFileNameMatch(const char *fileName, const char *pattern)
+{
+    const char *starPattern = NULL;     // Pattern position after last '*' found
+    const char *starFileName = NULL;    // File name position matched by last '*'
+
+    while (*fileName != '\0')
+    {
+        if ((*pattern == '?') || (*pattern == *fileName)) { fileName++; pattern++; }
+        else if (*pattern == '*') { starPattern = ++pattern; starFileName = fileName; }
+        else if (starPattern != NULL) { pattern = starPattern; fileName = ++starFileName; }
+        else return false;
+    }
+
+    while (*pattern == '*') pattern++;
+
+    return (*pattern == '\0');
+}
+
+// Get value from flat JSON object text
+// NOTE: Only flat objects supported (no nested objects or arrays search),
+// returns 0 if key not found, 1 if value is a string (unescaped), 2 for other values (number, bool, null)
+static int GetJsonValue(const char *json, const char *key, char *value, int valueSize)
+{
+    int result = 0;
+    int keyLength = (int)strlen(key);
+    const char *ptr = json;
+
+    value[0] = '\0';
+
+    while ((ptr = strchr(ptr, '"')) != NULL)
+    {
+        // Check quoted key followed by ':'
+        const char *next = ptr + 1 + keyLength;
+        bool keyFound = (strncmp(ptr + 1, key, keyLength) == 0) && (*next == '"');
+
+        if (keyFound)
+        {
+            next++;
+            while ((*next == ' ') || (*next == '\t')) next++;
+            keyFound = (*next == ':');
+        }
+
+        if (!keyFound)
+        {
+            // Skip current string, including escaped characters
+            ptr++;
+            while ((*ptr != '\0') && (*ptr != '"')) { if ((*ptr == '\\') && (ptr[1] != '\0')) ptr++; ptr++; }
+            if (*ptr == '\0') break;
+            ptr++;
+            continue;
+        }
+
+        next++;
+        while ((*next == ' ') || (*next == '\t')) next++;
+
+        int length = 0;
+
+        if (*next == '"')
+        {
+            // String value, unescape basic sequences
+            next++;
+            while ((*next != '\0') && (*next != '"') && (length < (valueSize - 1)))
+            {
+                if ((*next == '\\') && (next[1] != '\0'))
+                {
+                    next++;
+                    switch (*next)
+                    {
+                        case 'n': value[length++] = '\n'; break;
+                        case 't': value[length++] = '\t'; break;
+                        case 'r': value[length++] = '\r'; break;
+                        default: value[length++] = *next; break;     // '"', '\\', '/'
+                    }
+                }
+                else value[length++] = *next;
+
+                next++;
+            }
+
+            result = 1;
+        }
+        else
+        {
+            // Other value: number, true, false, null
+            while ((*next != '\0') && (*next != ',') && (*next != '}') && (*next != ' ') &&
+                   (*next != '\r') && (*next != '\n') && (length < (valueSize - 1))) value[length++] = *next++;
+
+            if (length > 0) result = 2;
+        }
+
+        value[length] = '\0';
+        break;
+    }
+
+    return result;
+}
+
+// Print text as JSON string to stdout
+static void PrintJsonString(const char *text)
+{
+    putchar('"');
+
+    for (int i = 0; text[i] != '\0'; i++)
+    {
+        switch (text[i])
+        {
+            case '"': printf("\\\""); break;
+            case '\\': printf("\\\\"); break;
+            case '\n': printf("\\n"); break;
+            case '\r': printf("\\r"); break;
+            case '\t': printf("\\t"); break;
+            default:
+            {
+                if ((unsigned char)text[i] < 0x20) printf("\\u%04x", text[i]);
+                else putchar(text[i]);
+            } break;
+        }
+    }
+
+    putchar('"');
+}
+
+// Begin profiling stage
+// NOTE: Stages can be nested (i.e. compression on file write), nested stage time is
+// excluded from parent stage, so all stages time adds up to total conversion time
+static void ProfileStageBegin(int stage)
+{
+    if (!profileEnabled || (profileStackCount >= 16)) return;
+
+    double time = GetTimeStamp();
+
+    // Pause parent stage
+    if (profileStackCount > 0)
+    {
+        ProfileStageData *parent = &profileStages[profileStack[profileStackCount - 1]];
+        parent->time += (time - parent->startTime);
+    }
+
+    profileStages[stage].startTime = time;
+    profileStack[profileStackCount] = stage;
+    profileStackCount++;
+}
+
+// End profiling stage, accumulating time and processed bytes
+static void ProfileStageEnd(int stage, int bytes)
+{
+    if (!profileEnabled || (profileStackCount == 0) || (profileStack[profileStackCount - 1] != stage)) return;
+
+    double time = GetTimeStamp();
+
+    profileStages[stage].time += (time - profileStages[stage].startTime);
+    profileStages[stage].bytes += bytes;
+    profileStages[stage].calls++;
+    profileStackCount--;
+
+    // Resume parent stage
+    if (profileStackCount > 0) profileStages[profileStack[profileStackCount - 1]].startTime = time;
+}
+
+// End file profiling, data added to totals and CSV report
+static void ProfileFileEnd(const char *fileName)
+{
+    if (!profileEnabled) return;
+
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+    {
+        if ((profileCsvFile != NULL) && (profileStages[i].calls > 0))
+        {
+            fprintf(profileCsvFile, "\"%s\",%s,%i,%.4f,%lld\n", fileName, profileStageNames[i],
+                profileStages[i].calls, profileStages[i].time*1000.0, profileStages[i].bytes);
+        }
+
+        profileTotals[i].time += profileStages[i].time;
+        profileTotals[i].bytes += profileStages[i].bytes;
+        profileTotals[i].calls += profileStages[i].calls;
+        profileStages[i] = (ProfileStageData){ 0 };
+    }
+
+    profileStackCount = 0;
+    profileFileCount++;
+}
+
+// Show profiling report, all files stages totals
+static void ShowProfileReport(FILE *output)
+{
+    double totalTime = 0.0;
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++) totalTime += profileTotals[i].time;
+    if (totalTime <= 0.0) totalTime = 0.000001;
+
+    fprintf(output, "\nProfile: %i file(s), %.3f ms\n\n", profileFileCount, totalTime*1000.0);
+    fprintf(output, "    %-16s %8s %12s %7s %14s %10s\n", "stage", "calls", "time (ms)", "%", "bytes", "MB/s");
+
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+    {
+        if (profileTotals[i].calls == 0) continue;
+
+        fprintf(output, "    %-16s %8i %12.3f %6.1f%% %14lld %10.2f\n", profileStageNames[i], profileTotals[i].calls,
+            profileTotals[i].time*1000.0, profileTotals[i].time*100.0/totalTime, profileTotals[i].bytes,
+            (profileTotals[i].time > 0.0)? (profileTotals[i].bytes/(1024.0*1024.0))/profileTotals[i].time : 0.0);
+    }
+}
+
+// Append text to text buffer, buffer grown if required
+// NOTE: Text length -1 for NULL-terminated text, buffer data is always kept NULL-terminated
+static void TextBufferAppend(TextBuffer *buffer, const char *text, int length)
+{
+    if (length < 0) length = (int)strlen(text);
+
+    if ((buffer->length + length + 1) > buffer->capacity)
+    {
+        int capacity = (buffer->capacity > 0)? buffer->capacity*2 : 1024;
+        while ((buffer->length + length + 1) > capacity) capacity *= 2;
+
+        buffer->data = (char *)RL_REALLOC(buffer->data, capacity);
+        buffer->capacity = capacity;
+    }
+
+    memcpy(buffer->data + buffer->length, text, length);
+    buffer->length += length;
+    buffer->data[buffer->length] = '\0';
+}
+
+// Append style property fields to text buffer: p <controlId> <propertyId> <propertyValue>
+// NOTE: Same output as "p %02i %02i 0x%08x    ", formatted without printf(), ids expected in range [0..99]
+static void TextBufferAppendProperty(TextBuffer *buffer, int controlId, int propertyId, unsigned int value)
+{
+    static const char hexDigits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+    char line[24] = { 'p', ' ', '0', '0', ' ', '0', '0', ' ', '0', 'x' };
+
+    line[2] = (char)('0' + (controlId/10)%10);
+    line[3] = (char)('0' + controlId%10);
+    line[5] = (char)('0' + (propertyId/10)%10);
+    line[6] = (char)('0' + propertyId%10);
+    for (int i = 0; i < 8; i++) line[10 + i] = hexDigits[(value >> (28 - i*4)) & 0xf];
+    memcpy(line + 18, "    ", 4);
+
+    TextBufferAppend(buffer, line, 22);
+}
+
+// Append integer value to text buffer, as decimal text
+// NOTE: Same output as "%i", formatted without printf()
+static void TextBufferAppendInteger(TextBuffer *buffer, int value)
+{
+    char digits[12] = { 0 };
+    int length = 0;
+    unsigned int absValue = (value < 0)? (0u - (unsigned int)value) : (unsigned int)value;
+
+    do
+    {
+        digits[11 - length] = (char)('0' + absValue%10);
+        absValue /= 10;
+        length++;
+    } while (absValue > 0);
+
+    if (value < 0)
+    {
+        digits[11 - length] = '-';
+        length++;
+    }
+
+    TextBufferAppend(buffer, digits + 12 - length, length);
+}
+
+// Append bytes to text buffer, as hexadecimal values array
+// NOTE: Same output as "0x%02x, " per byte (new line every 20 values), last value with no separator
+static void TextBufferAppendBytesArray(TextBuffer *buffer, const unsigned char *data, int dataSize)
+{
+    static const char hexDigits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+    char line[20*12] = { 0 };
+    int length = 0;
+
+    for (int i = 0; i < dataSize; i++)
+    {
+        line[length++] = '0';
+        line[length++] = 'x';
+        line[length++] = hexDigits[data[i] >> 4];
+        line[length++] = hexDigits[data[i] & 0xf];
+
+        if (i < (dataSize - 1))
+        {
+            if (i%20 == 0)
+            {
+                memcpy(line + length, ",\n    ", 6);
+                length += 6;
+            }
+            else
+            {
+                memcpy(line + length, ", ", 2);
+                length += 2;
+            }
+        }
+
+        // NOTE: Line text flushed to buffer on every new line (and on last value)
+        if ((i%20 == 0) || (i == (dataSize - 1)))
+        {
+            TextBufferAppend(buffer, line, length);
+            length = 0;
+        }
+    }
+}
+
+// Append bytes to text buffer, as string literal (octal escaped)
+// NOTE: Printable characters written as is, string literal is split in lines of ~100 characters,
+// shortest octal escape used if next character is not an octal digit (escapes are up to 3 digits)
+static void TextBufferAppendBytesString(TextBuffer *buffer, const unsigned char *data, int dataSize)
+{
+    char line[128] = { 0 };
+    int length = 0;
+
+    for (int i = 0; i < dataSize; i++)
+    {
+        unsigned char byte = data[i];
+
+        // NOTE: Quotes, backslashes and question marks (trigraphs) are always escaped
+        if ((byte >= 32) && (byte < 127) && (byte != '\"') && (byte != '\\') && (byte != '?')) line[length++] = (char)byte;
+        else
+        {
+            bool nextDigit = ((i + 1) < dataSize) && (data[i + 1] >= '0') && (data[i + 1] <= '7');
+
+            line[length++] = '\\';
+            if (nextDigit || (byte >= 64)) line[length++] = (char)('0' + (byte >> 6));
+            if (nextDigit || (byte >= 8)) line[length++] = (char)('0' + ((byte >> 3) & 7));
+            line[length++] = (char)('0' + (byte & 7));
+        }
+
+        if ((length >= 96) && (i < (dataSize - 1)))
+        {
+            memcpy(line + length, "\"\n    \"", 7);
+            TextBufferAppend(buffer, line, length + 7);
+            length = 0;
+        }
+    }
+
+    TextBufferAppend(buffer, line, length);
+}